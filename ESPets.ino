@@ -10,15 +10,36 @@
  *    globals.cpp     Global variable definitions
  *    input.h/.cpp    Button polling & debounce
  *    pet.h/.cpp      Pet logic (decay, feed, mood, sleep)
+ *    pet_model.h     Closed-form stat model (host-testable)
  *    game_star.h/.cpp  Star-catch mini-game logic
  *    nav.h/.cpp      View switching & button dispatch
+ *    sched.h/.cpp    Deadline scheduler (timer wheel, loop sleep)
+ *    frame_gov.h/.cpp Per-view frame-rate governor
+ *    power.h/.cpp    Light sleep between events, deep-sleep hibernation
+ *    bus_async.h/.cpp  Queued SPI/DMA panel bus (PANEL_ASYNC_BUS)
+ *    bus_cmdopt.h/.cpp ST7789 command-stream optimizer (PANEL_CMD_OPT)
+ *    panel_profile.h/.cpp Gamma / backlight colour profiles
+ *    fb_indexed.h/.cpp 4bpp off-screen framebuffer (FB_INDEXED)
  *    ui_common.h/.cpp  Shared draw helpers (pet, notif, splash)
+ *    ui_sprite.h/.cpp  Cached RGB565 pet sprites (one blit per tick)
+ *    ui_damage.h/.cpp  Dirty-rect compositor (clipped partial redraws)
+ *    ui_text.h/.cpp    Flash glyph atlas, opaque text runs, fmtInt
+ *    ui_field.h/.cpp   Change-aware text / bar fields (delta repaint)
+ *    ui_compose.h/.cpp Band compositor for game playfields
+ *    ui_halfres.h/.cpp Half-resolution canvas, 2× upscaled on push
+ *    ui_asset.h/.cpp   Streaming decoder for compressed assets
+ *    ui_blend.h/.cpp   RGB565 SWAR blend / fade kernels
+ *    asset_pak.h/.cpp  Memory-mapped read-only asset partition
+ *    asset_ids.h       Asset ids, generated by tools/asset_image.py
+ *    ui_dlist.h/.cpp   Recorded display lists for static chrome
+ *    ui_slide.h/.cpp   Hardware-scrolled view transitions
  *    ui_main.h/.cpp    Main (home) screen
  *    ui_feed.h/.cpp    Feed screen
  *    ui_play.h/.cpp    Play screen
  *    ui_status.h/.cpp  Status screen
  *    ui_sleep.h/.cpp   Sleep screen
  *    creature_gen.h/.cpp Procedural creature generation from ChipId
+ *    tests/          Host unit tests (cmake -S tests -B build/tests)
  *
  *  Single-button control (BOOT / GPIO 0) via OneButton library:
  *    single click  → cycle / next / catch
@@ -45,12 +66,78 @@
 #include "nav.h"
 #include "ui_common.h"
 #include "ui_main.h"
+#include "ui_sprite.h"
+#include "ui_damage.h"
+#include "ui_slide.h"
+#include "fb_indexed.h"
+#include "bus_async.h"
+#include "bus_cmdopt.h"
 #include "ui_play_balance.h"
+#include "asset_pak.h"
+#include "panel_profile.h"
+#include "sched.h"
+#include "frame_gov.h"
+#include "power.h"
+
+// ==========================================================
+//  TASKS
+// ==========================================================
+static int8_t taskInput  = -1;
+static int8_t taskNotif  = -1;
+static int8_t taskDecay  = -1;
+static int8_t taskHibern = -1;
+static bool   gameStepped = false;   // balance has a new frame to draw
+
+static void runInput() {
+  inputUpdate();
+  bool active = !inputIdle();
+  govOnInput(active);          // ramp polling / wake the game
+  if (active) schedAfter(taskHibern, powerHibernateDelay());
+}
+
+static void runGame() {
+  if (currentView == VIEW_PLAY_RHYTHM) {
+    rhythmGameUpdate();
+  } else {
+    balanceGameUpdate();       // physics + IMU read (rate-limited inside)
+    gameStepped = true;
+  }
+  govOnGameStep();             // beat game: sleep to the next beat
+}
+
+static void runAnim() {
+  animFrame ^= 1;
+  creatureUpdateTime(millis());
+  if (!slideActive()) navUpdateAnimation();
+}
+
+static void runDecay() {
+  petTickDecay();
+  // Update bars on main view without full redraw
+  if (currentView == VIEW_MAIN && !slideActive()) uiMainDrawStatBars();
+  // Sleep view picks the new values up on its next anim tick
+}
+
+static void runHibernate() {
+  if (powerShouldHibernate()) powerHibernate();
+  schedAfter(taskHibern, powerHibernateDelay());   // still busy / game view
+}
+
+static void runNotifExpiry() {
+  if (!notif.active) return;
+  if (slideActive()) { schedAfter(taskNotif, FRAME_TIME_MS); return; }
+  notif.active = false;
+  notif.drawn  = false;
+  damageRedrawRect(6, 28, 228, 22);   // restore what the box covered
+}
 
 // ==========================================================
 //  SETUP
 // ==========================================================
 void setup() {
+  // Hibernation timer wake: back to sleep unless BOOT is held
+  bool resumed = powerHibernateWake();
+
   Serial.begin(115200);
   delay(500);
   Serial.println("\n\n=== ESPets Tamagotchi v6 ===");
@@ -69,8 +156,18 @@ void setup() {
   // ── Input ─────────────────────────────────────────────
   inputInit();
 
+  // ── Asset partition (built-in defaults if not flashed) ──
+  pakInit();
+
   // ── Display ───────────────────────────────────────────
+#if PANEL_ASYNC_BUS
+  bus = new AsyncSpiBus(PIN_DC, PIN_CS, PIN_SCK, PIN_MOSI);
+#else
   bus = new Arduino_HWSPI(PIN_DC, PIN_CS, PIN_SCK, PIN_MOSI);
+#endif
+#if PANEL_CMD_OPT
+  bus = new CmdStreamBus(bus);
+#endif
   gfx = new Arduino_ST7789(bus, PIN_RST, 0, false, 240, 280, 0, 20);
 
   if (!gfx->begin()) {
@@ -80,8 +177,13 @@ void setup() {
       digitalWrite(PIN_BL, LOW);  delay(150);
     }
   }
+  profileInit();      // backlight → PWM, day gamma
 
+#if FB_INDEXED
+  fbInit();           // gfx now draws off-screen; fbFlush() pushes
+#endif
   gfx->fillScreen(COL_BG_MAIN);
+  fbFlush();
 
   // ── IMU (QMI8658) ─────────────────────────────────────
   Serial.println("\n[STARTUP] Initializing QMI8658 IMU (SDA=GPIO8, SCL=GPIO7)...");
@@ -107,17 +209,35 @@ void setup() {
   pet.seed = chipSeed;
   creatureUpdateTime(millis());
 
-  // ── Splash ────────────────────────────────────────────
-  drawSplash();
-  delay(2500);
+  // ── Splash (not when resuming from hibernation) ───────
+  if (!resumed) {
+    drawSplash();
+    fbFlush();
+    delay(2500);
+    petSpriteFlush();   // splash-size sprite is never drawn again
+  }
 
   // ── Init game & state ─────────────────────────────────
   randomSeed((uint32_t)esp_random());
   starGameReset();
   rhythmGameInit();
   balanceGameInit();
+  if (resumed) powerRestore();   // stats, view, catch-up
   viewDirty = true;
 
+  // ── Tasks ─────────────────────────────────────────────
+  taskInput = schedEvery("input", runInput, INPUT_POLL_MS, PRIO_HIGH);
+  int8_t taskGame = schedEvery("game", runGame, FRAME_TIME_MS, PRIO_HIGH,
+      VIEW_BIT(VIEW_PLAY_RHYTHM) | VIEW_BIT(VIEW_PLAY_BALANCE));
+  schedEvery("anim", runAnim, ANIM_INTERVAL, PRIO_NORMAL, govAnimMask());
+  taskDecay = schedEvery("decay", runDecay, DECAY_INTERVAL, PRIO_LOW);
+  schedAfter(taskDecay, DECAY_INTERVAL - petPhaseMs());   // model's tick phase
+  taskHibern = schedOnce("hibern", runHibernate, PRIO_LOW);
+  schedAfter(taskHibern, powerHibernateDelay());   // idle deadline only
+  taskNotif = schedOnce("notif", runNotifExpiry, PRIO_NORMAL);
+  govInit(taskInput, taskGame);
+  powerInit();
+
   Serial.println("=== Boot complete ===");
 }
 
@@ -125,65 +245,46 @@ void setup() {
 //  LOOP
 // ==========================================================
 void loop() {
-  // ── Frame rate cap (60 FPS = ~16.67ms per frame) ────────────
-  static uint32_t lastFrameTime = 0;
-  uint32_t now = millis();
-  uint32_t elapsedSinceLastFrame = now - lastFrameTime;
-
-  if (elapsedSinceLastFrame < FRAME_TIME_MS) {
-    delay(FRAME_TIME_MS - elapsedSinceLastFrame);
-    lastFrameTime = millis();
-  } else {
-    lastFrameTime = now;
-  }
-
-  now = millis();  // Update now after potential delay
+  // ── Due tasks (input, game physics, anim, decay) ──────
+  schedRun(millis());
 
-  // ── Input ─────────────────────────────────────────────
-  inputUpdate();
+  // ── Wait for last frame's pixels (overlapped the above) ─
+  asyncBusFence();
+  cmdBusFrameBegin();
+  profileUpdate();             // night profile follows sleep
 
-  // ── Game updates ───────────────────────────────────────
-  if (currentView == VIEW_PLAY_RHYTHM) {
-    rhythmGameUpdate();
-  } else if (currentView == VIEW_PLAY_BALANCE) {
-    balanceGameUpdate();       // physics + IMU read (rate-limited inside)
-    if (!viewDirty) {
-      uiPlayBalanceAnimate();  // draw at 60 FPS, not the 600ms anim tick
-    }
+  if (gameStepped && currentView == VIEW_PLAY_BALANCE &&
+      !viewDirty && !slideActive()) {
+    uiPlayBalanceAnimate();    // once per physics step, not the anim tick
   }
+  gameStepped = false;
 
   // ── Full redraw (view switch or forced) ───────────────
   if (viewDirty) {
     viewDirty = false;
-    navDrawFullView();
+    navDrawFullView();          // may start a slide instead
+  } else if (slideActive()) {
+    slideStep();                // transition owns the panel
+  } else if (damagePending()) {
+    damageFlush();     // partial: only invalidated regions
   }
 
-  // ── Partial animation ─────────────────────────────────
-  if (now - lastAnimTick >= ANIM_INTERVAL) {
-    lastAnimTick = now;
-    animFrame ^= 1;
-    creatureUpdateTime(now);
-    navUpdateAnimation();
+  // ── Notification (expiry is the notif task) ───────────
+  if (notif.active && !notif.drawn && !slideActive()) {
+    drawNotification();
+    notif.drawn = true;
+    int32_t left = (int32_t)(notif.endTime - millis());
+    schedAfter(taskNotif, left > 0 ? left : 0);
   }
 
-  // ── Stat decay ────────────────────────────────────────
-  if (now - lastDecayTick >= DECAY_INTERVAL) {
-    lastDecayTick = now;
-    petTickDecay();
-    // Update bars on main view without full redraw
-    if (currentView == VIEW_MAIN) uiMainDrawStatBars();
-    if (currentView == VIEW_SLEEP) viewDirty = true;
-  }
+  // ── Present (framebuffer mode: changed rows only) ─────
+  fbFlush();
+  cmdBusFrameEnd();
 
-  // ── Notification lifecycle ────────────────────────────
-  if (notif.active && now >= notif.endTime) {
-    notif.active = false;
-    gfx->fillRect(0, 24, SCREEN_W, 28, navViewBgColor());
-    notif.drawn = false;
-    viewDirty = true;
-  }
-  if (notif.active && !notif.drawn) {
-    drawNotification();
-    notif.drawn = true;
+  // ── Sleep until the next task falls due ───────────────
+  govCountWake();
+  if (slideActive() || viewDirty) schedRequestFrame();
+  if (powerWaitUntil(schedNextWake(millis()))) {
+    schedAfter(taskInput, 0);   // button woke us: poll it now
   }
 }
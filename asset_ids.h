@@ -0,0 +1,23 @@
+/*
+ * asset_ids.h — Asset partition ids
+ * ───────────────────────────────────
+ * Generated by tools/asset_image.py from assets/pak.txt —
+ * do not edit.  Ids index the partition's table of contents.
+ */
+#pragma once
+
+#include <Arduino.h>
+
+#define PAK_VERSION      1
+
+#define PAK_KIND_RAW    0
+#define PAK_KIND_Q565   1
+#define PAK_KIND_U16    2
+#define PAK_KIND_I32    3
+
+enum PakId : uint16_t {
+  PAK_GROUND,          // q565 212 bytes
+  PAK_MAZE_LEVELS,     // i32  80 bytes
+  PAK_RHYTHM_BEATS,    // u16  6 bytes
+  PAK_COUNT
+};
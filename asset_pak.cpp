@@ -0,0 +1,105 @@
+/*
+ * asset_pak.cpp — Read-only asset partition (memory-mapped)
+ * ───────────────────────────────────────────────────────────
+ * Image layout is documented in tools/asset_image.py.  Only the
+ * header and table of contents are checked at boot (the CRC is
+ * the host tool's job); every entry's extent is bounds-checked
+ * once here so pakGet() can trust it; a bad image is unmapped
+ * again.
+ */
+#include "asset_pak.h"
+#include <esp_partition.h>
+
+struct PakHeader {
+  char     magic[4];   // 'EPAK'
+  uint16_t version;
+  uint16_t count;
+  uint32_t size;
+  uint32_t crc;
+};
+
+struct PakEntry {
+  uint32_t offset;
+  uint32_t size;
+  uint16_t kind;
+  uint16_t reserved;
+};
+
+static const uint8_t*  base = nullptr;   // start of the mapping
+static const PakEntry* toc  = nullptr;
+
+// Header, TOC and every extent must lie inside the image, and
+// the image inside the partition (the mapping's length)
+static bool validImage(const PakHeader* hdr, uint32_t partSize) {
+  if (memcmp(hdr->magic, "EPAK", 4) != 0 || hdr->version != PAK_VERSION ||
+      hdr->count != PAK_COUNT || hdr->size > partSize ||
+      sizeof(PakHeader) + (uint32_t)hdr->count * sizeof(PakEntry) > hdr->size) {
+    Serial.println("[PAK] Partition empty or built for other asset ids");
+    return false;
+  }
+
+  const PakEntry* entries = (const PakEntry*)(hdr + 1);
+  for (uint16_t i = 0; i < hdr->count; i++) {
+    if ((uint64_t)entries[i].offset + entries[i].size > hdr->size) {
+      Serial.printf("[PAK] Entry %u out of bounds\n", i);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool pakInit() {
+  const esp_partition_t* part = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)PAK_PARTITION_SUBTYPE,
+      PAK_PARTITION_LABEL);
+  if (!part) {
+    Serial.println("[PAK] No assets partition, using built-in defaults");
+    return false;
+  }
+
+  const void* map = nullptr;
+  esp_partition_mmap_handle_t handle;
+  if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA,
+                         &map, &handle) != ESP_OK) {
+    Serial.println("[PAK] mmap failed");
+    return false;
+  }
+
+  const PakHeader* hdr = (const PakHeader*)map;
+  if (!validImage(hdr, part->size)) {
+    esp_partition_munmap(handle);
+    return false;
+  }
+
+  base = (const uint8_t*)map;
+  toc  = (const PakEntry*)(hdr + 1);
+  Serial.printf("[PAK] %u assets, %lu bytes mapped\n", hdr->count,
+                (unsigned long)hdr->size);
+  return true;
+}
+
+bool pakReady() {
+  return base != nullptr;
+}
+
+const uint8_t* pakGet(PakId id, uint32_t* size) {
+  if (!base || id >= PAK_COUNT) return nullptr;
+  if (size) *size = toc[id].size;
+  return base + toc[id].offset;
+}
+
+const uint16_t* pakTableU16(PakId id, uint32_t count) {
+  uint32_t size;
+  const uint8_t* p = pakGet(id, &size);
+  if (!p || toc[id].kind != PAK_KIND_U16 || size != count * sizeof(uint16_t))
+    return nullptr;
+  return (const uint16_t*)p;
+}
+
+const int32_t* pakTableI32(PakId id, uint32_t count) {
+  uint32_t size;
+  const uint8_t* p = pakGet(id, &size);
+  if (!p || toc[id].kind != PAK_KIND_I32 || size != count * sizeof(int32_t))
+    return nullptr;
+  return (const int32_t*)p;
+}
@@ -0,0 +1,35 @@
+/*
+ * asset_pak.h — Read-only asset partition (memory-mapped)
+ * ─────────────────────────────────────────────────────────
+ * Artwork and game data live in their own flash partition
+ * (`assets` in partitions.csv), built from assets/pak.txt by
+ * tools/asset_image.py and flashed separately from the sketch.
+ * pakInit() maps the whole partition into the data cache once;
+ * pakGet() then indexes the table of contents by PakId and
+ * returns a pointer straight into the mapping — O(1), no heap,
+ * no copy.
+ *
+ * When the partition is missing, unflashed or built for a
+ * different asset_ids.h, pakGet() returns nullptr and callers
+ * use their built-in defaults.
+ */
+#pragma once
+
+#include "types.h"
+#include "asset_ids.h"
+
+#define PAK_PARTITION_LABEL    "assets"
+#define PAK_PARTITION_SUBTYPE  0x40   // custom data subtype
+
+// Map and validate the partition (call once from setup)
+bool pakInit();
+
+bool pakReady();
+
+// Asset bytes and size, or nullptr when unavailable
+const uint8_t* pakGet(PakId id, uint32_t* size = nullptr);
+
+// Typed view of a u16 / i32 table; nullptr unless it holds
+// exactly `count` elements
+const uint16_t* pakTableU16(PakId id, uint32_t count);
+const int32_t*  pakTableI32(PakId id, uint32_t count);
@@ -0,0 +1,217 @@
+/*
+ * bus_async.cpp — Queued SPI/DMA bus for the ST7789
+ * ───────────────────────────────────────────────────
+ * The D/C line is driven from the pre-transaction callback;
+ * transaction.user carries (slot << 1) | dc so the callbacks
+ * can find their sequence number without extra state.
+ */
+#include "bus_async.h"
+#include <driver/gpio.h>
+#include <esp_heap_caps.h>
+
+static AsyncSpiBus* activeBus = nullptr;
+static int8_t       dcPin     = -1;
+
+// ══════════════════════════════════════════════════════════
+//  ISR CALLBACKS
+// ══════════════════════════════════════════════════════════
+
+static void IRAM_ATTR preCb(spi_transaction_t* t) {
+  gpio_set_level((gpio_num_t)dcPin, (uintptr_t)t->user & 1);
+}
+
+void IRAM_ATTR asyncBusPostCb(spi_transaction_t* t) {
+  AsyncSpiBus* b = activeBus;
+  uint32_t seq = b->_transSeq[(uintptr_t)t->user >> 1];
+  b->_completedIsr = seq;
+  if (b->_cb) b->_cb(seq, b->_cbArg);
+}
+
+// ══════════════════════════════════════════════════════════
+//  SETUP
+// ══════════════════════════════════════════════════════════
+
+AsyncSpiBus::AsyncSpiBus(int8_t dc, int8_t cs, int8_t sck, int8_t mosi)
+  : _dc(dc), _cs(cs), _sck(sck), _mosi(mosi) {}
+
+bool AsyncSpiBus::begin(int32_t speed, int8_t dataMode) {
+  if (speed == GFX_NOT_DEFINED) speed = ASYNC_DEFAULT_HZ;
+  if (dataMode == GFX_NOT_DEFINED) dataMode = 0;
+
+  pinMode(_dc, OUTPUT);
+  dcPin     = _dc;
+  activeBus = this;
+
+  for (int i = 0; i < ASYNC_DMA_BUFS; i++) {
+    _buf[i] = (uint8_t*)heap_caps_malloc(ASYNC_DMA_BUF_BYTES, MALLOC_CAP_DMA);
+    if (!_buf[i]) return false;
+  }
+
+  spi_bus_config_t buscfg = {};
+  buscfg.mosi_io_num     = _mosi;
+  buscfg.miso_io_num     = -1;
+  buscfg.sclk_io_num     = _sck;
+  buscfg.quadwp_io_num   = -1;
+  buscfg.quadhd_io_num   = -1;
+  buscfg.max_transfer_sz = ASYNC_DMA_BUF_BYTES;
+  if (spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO) != ESP_OK)
+    return false;
+
+  spi_device_interface_config_t devcfg = {};
+  devcfg.clock_speed_hz = speed;
+  devcfg.mode           = dataMode;
+  devcfg.spics_io_num   = _cs;
+  devcfg.queue_size     = ASYNC_QUEUE_DEPTH;
+  devcfg.pre_cb         = preCb;
+  devcfg.post_cb        = asyncBusPostCb;
+  return spi_bus_add_device(SPI2_HOST, &devcfg, &_dev) == ESP_OK;
+}
+
+// ══════════════════════════════════════════════════════════
+//  QUEUE
+// ══════════════════════════════════════════════════════════
+
+// Transactions complete in order, so reclaiming the oldest is
+// always the one get_trans_result hands back
+void AsyncSpiBus::reclaimOne() {
+  spi_transaction_t* t;
+  spi_device_get_trans_result(_dev, &t, portMAX_DELAY);
+  _inFlight--;
+  _reclaimed++;
+}
+
+static inline spi_transaction_t& nextSlot(spi_transaction_t* trans,
+                                          uint8_t head) {
+  spi_transaction_t& t = trans[head];
+  memset(&t, 0, sizeof(t));
+  return t;
+}
+
+void AsyncSpiBus::queueInline(bool dc, const uint8_t* data, uint8_t len) {
+  if (_inFlight == ASYNC_QUEUE_DEPTH) reclaimOne();
+  uint8_t slot = _transHead;
+  spi_transaction_t& t = nextSlot(_trans, slot);
+  t.flags  = SPI_TRANS_USE_TXDATA;
+  t.length = len * 8;
+  memcpy(t.tx_data, data, len);
+  t.user   = (void*)(uintptr_t)((slot << 1) | (dc ? 1 : 0));
+  _transSeq[slot] = ++_submitted;
+  _transHead = (slot + 1) % ASYNC_QUEUE_DEPTH;
+  _inFlight++;
+  spi_device_queue_trans(_dev, &t, portMAX_DELAY);
+}
+
+void AsyncSpiBus::queueBuffer(bool dc, const uint8_t* buf, uint32_t len) {
+  if (_inFlight == ASYNC_QUEUE_DEPTH) reclaimOne();
+  uint8_t slot = _transHead;
+  spi_transaction_t& t = nextSlot(_trans, slot);
+  t.length    = len * 8;
+  t.tx_buffer = buf;
+  t.user      = (void*)(uintptr_t)((slot << 1) | (dc ? 1 : 0));
+  _transSeq[slot] = ++_submitted;
+  _transHead = (slot + 1) % ASYNC_QUEUE_DEPTH;
+  _inFlight++;
+  spi_device_queue_trans(_dev, &t, portMAX_DELAY);
+}
+
+// Index of the next bounce buffer, once the DMA reading it has
+// finished.  Callers record their last transaction in _bufSeq.
+uint8_t AsyncSpiBus::takeBuffer() {
+  uint8_t i = _bufHead;
+  while ((int32_t)(_reclaimed - _bufSeq[i]) < 0) reclaimOne();
+  _bufHead = (i + 1) % ASYNC_DMA_BUFS;
+  return i;
+}
+
+void AsyncSpiBus::fence() {
+  while (_inFlight) reclaimOne();
+}
+
+// ══════════════════════════════════════════════════════════
+//  ARDUINO_DATABUS
+// ══════════════════════════════════════════════════════════
+
+void AsyncSpiBus::writeCommand(uint8_t c) {
+  queueInline(false, &c, 1);
+}
+
+void AsyncSpiBus::writeCommand16(uint16_t c) {
+  uint8_t b[2] = { (uint8_t)(c >> 8), (uint8_t)c };
+  queueInline(false, b, 2);
+}
+
+void AsyncSpiBus::writeCommandBytes(uint8_t* data, uint32_t len) {
+  while (len) {
+    uint8_t n = min(len, (uint32_t)4);
+    queueInline(false, data, n);
+    data += n; len -= n;
+  }
+}
+
+void AsyncSpiBus::write(uint8_t d) {
+  queueInline(true, &d, 1);
+}
+
+void AsyncSpiBus::write16(uint16_t d) {
+  uint8_t b[2] = { (uint8_t)(d >> 8), (uint8_t)d };
+  queueInline(true, b, 2);
+}
+
+// Window setup: one command + one 4-byte data transaction
+void AsyncSpiBus::writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2) {
+  uint8_t b[4] = { (uint8_t)(d1 >> 8), (uint8_t)d1,
+                   (uint8_t)(d2 >> 8), (uint8_t)d2 };
+  queueInline(false, &c, 1);
+  queueInline(true, b, 4);
+}
+
+void AsyncSpiBus::writeBytes(uint8_t* data, uint32_t len) {
+  while (len) {
+    uint32_t n = min(len, (uint32_t)ASYNC_DMA_BUF_BYTES);
+    uint8_t bi = takeBuffer();
+    memcpy(_buf[bi], data, n);
+    queueBuffer(true, _buf[bi], n);
+    _bufSeq[bi] = _submitted;
+    data += n; len -= n;
+  }
+}
+
+void AsyncSpiBus::writePixels(uint16_t* data, uint32_t len) {
+  const uint32_t perBuf = ASYNC_DMA_BUF_BYTES / 2;
+  while (len) {
+    uint32_t n = min(len, perBuf);
+    uint8_t bi = takeBuffer();
+    uint16_t* buf = (uint16_t*)_buf[bi];
+    for (uint32_t i = 0; i < n; i++)
+      buf[i] = (data[i] << 8) | (data[i] >> 8);   // panel is big-endian
+    queueBuffer(true, _buf[bi], n * 2);
+    _bufSeq[bi] = _submitted;
+    data += n; len -= n;
+  }
+}
+
+// One buffer of the colour, queued repeatedly (read-only, so
+// several in-flight transactions may share it)
+void AsyncSpiBus::writeRepeat(uint16_t p, uint32_t len) {
+  const uint32_t perBuf = ASYNC_DMA_BUF_BYTES / 2;
+  uint32_t n = min(len, perBuf);
+  uint8_t bi = takeBuffer();
+  uint16_t* buf = (uint16_t*)_buf[bi];
+  uint16_t sw = (p << 8) | (p >> 8);
+  for (uint32_t i = 0; i < n; i++) buf[i] = sw;
+
+  while (len) {
+    uint32_t chunk = min(len, perBuf);
+    queueBuffer(true, _buf[bi], chunk * 2);
+    _bufSeq[bi] = _submitted;
+    len -= chunk;
+  }
+}
+
+// ══════════════════════════════════════════════════════════
+//  PUBLIC
+// ══════════════════════════════════════════════════════════
+
+void asyncBusFence() {
+  if (activeBus) activeBus->fence();
+}
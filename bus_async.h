@@ -0,0 +1,92 @@
+/*
+ * bus_async.h — Queued SPI/DMA bus for the ST7789
+ * ─────────────────────────────────────────────────
+ * An Arduino_DataBus built on ESP-IDF's spi_master queue, so
+ * Arduino_ST7789 and everything above it work unchanged while
+ * pixel writes return as soon as they are queued:
+ *
+ *   writePixels   bitmap submission — copied (byte-swapped)
+ *                 into a DMA bounce buffer, then queued
+ *   writeRepeat   fill submission — one colour buffer queued
+ *                 as many times as the length needs
+ *   commands      ≤ 4-byte transactions carried inline
+ *
+ * Every transaction gets a sequence number; the completion
+ * callback runs (in ISR context) as each one finishes, and
+ * asyncBusFence() blocks until everything queued is on the
+ * panel.  The frame loop fences just before it starts drawing,
+ * so input and game physics overlap the previous frame's
+ * transfer.
+ *
+ * Enabled with PANEL_ASYNC_BUS in config.h.
+ */
+#pragma once
+
+#include "types.h"
+#include <driver/spi_master.h>
+
+#define ASYNC_QUEUE_DEPTH   16      // transactions in flight
+#define ASYNC_DMA_BUFS      4       // bounce buffers
+#define ASYNC_DMA_BUF_BYTES 4096
+#define ASYNC_DEFAULT_HZ    40000000
+
+// Called from the SPI ISR when transaction seq has completed
+typedef void (*AsyncBusCallback)(uint32_t seq, void* arg);
+
+class AsyncSpiBus : public Arduino_DataBus {
+public:
+  AsyncSpiBus(int8_t dc, int8_t cs, int8_t sck, int8_t mosi);
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED,
+             int8_t dataMode = GFX_NOT_DEFINED) override;
+  void beginWrite() override {}
+  void endWrite() override {}
+
+  void writeCommand(uint8_t c) override;
+  void writeCommand16(uint16_t c) override;
+  void writeCommandBytes(uint8_t* data, uint32_t len) override;
+  void write(uint8_t d) override;
+  void write16(uint16_t d) override;
+  void writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2) override;
+  void writeRepeat(uint16_t p, uint32_t len) override;
+  void writePixels(uint16_t* data, uint32_t len) override;
+  void writeBytes(uint8_t* data, uint32_t len) override;
+
+  // Sequence number of the last queued transaction
+  uint32_t mark() const { return _submitted; }
+  // True once transaction seq (from mark()) has completed
+  bool done(uint32_t seq) const { return (int32_t)(_completedIsr - seq) >= 0; }
+  // Block until every queued transaction has completed
+  void fence();
+  void onComplete(AsyncBusCallback cb, void* arg) { _cb = cb; _cbArg = arg; }
+
+private:
+  friend void asyncBusPostCb(spi_transaction_t* t);
+
+  void queueInline(bool dc, const uint8_t* data, uint8_t len);
+  void queueBuffer(bool dc, const uint8_t* buf, uint32_t len);
+  uint8_t takeBuffer();
+  void reclaimOne();
+
+  int8_t _dc, _cs, _sck, _mosi;
+  spi_device_handle_t _dev = nullptr;
+
+  spi_transaction_t _trans[ASYNC_QUEUE_DEPTH];
+  uint32_t          _transSeq[ASYNC_QUEUE_DEPTH];
+  uint8_t           _transHead = 0;
+  uint8_t           _inFlight  = 0;
+
+  uint8_t*  _buf[ASYNC_DMA_BUFS] = {};
+  uint32_t  _bufSeq[ASYNC_DMA_BUFS] = {};   // last transaction using it
+  uint8_t   _bufHead = 0;
+
+  uint32_t          _submitted = 0;
+  uint32_t          _reclaimed = 0;
+  volatile uint32_t _completedIsr = 0;
+
+  AsyncBusCallback _cb    = nullptr;
+  void*            _cbArg = nullptr;
+};
+
+// Wait for the panel bus to drain (no-op with the blocking bus)
+void asyncBusFence();
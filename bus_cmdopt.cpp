@@ -0,0 +1,137 @@
+/*
+ * bus_cmdopt.cpp — ST7789 command-stream optimizer
+ * ──────────────────────────────────────────────────
+ */
+#include "bus_cmdopt.h"
+
+#define ST_CASET  0x2A
+#define ST_RASET  0x2B
+#define ST_RAMWR  0x2C
+
+static CmdStreamBus* activeBus = nullptr;
+
+CmdStreamBus::CmdStreamBus(Arduino_DataBus* inner) : _in(inner) {
+  activeBus = this;
+}
+
+// ══════════════════════════════════════════════════════════
+//  WINDOW TRACKING
+// ══════════════════════════════════════════════════════════
+
+void CmdStreamBus::writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2) {
+  if (c == ST_CASET) {
+    _reqBytes += 5;
+    _dCol0 = d1; _dCol1 = d2;
+  } else if (c == ST_RASET) {
+    _reqBytes += 5;
+    _dRow0 = d1;                     // end row is always CMD_ROW_END
+  } else {
+    other();
+    _reqBytes += 5; _sentBytes += 5;
+    _in->writeC8D16D16(c, d1, d2);
+  }
+}
+
+void CmdStreamBus::writeC8D16D16Split(uint8_t c, uint16_t d1, uint16_t d2) {
+  writeC8D16D16(c, d1, d2);
+}
+
+// Bring the panel's window in line with the driver's
+void CmdStreamBus::sendWindow() {
+  if (!_haveCol || _dCol0 != _col0 || _dCol1 != _col1) {
+    _in->writeC8D16D16(ST_CASET, _dCol0, _dCol1);
+    _sentBytes += 5;
+    _col0 = _dCol0; _col1 = _dCol1; _haveCol = true;
+  }
+  if (!_haveRow || _dRow0 != _row0) {
+    _in->writeC8D16D16(ST_RASET, _dRow0, CMD_ROW_END);
+    _sentBytes += 5;
+    _row0 = _dRow0; _haveRow = true;
+  }
+}
+
+void CmdStreamBus::writeCommand(uint8_t c) {
+  if (c != ST_RAMWR) {
+    other();
+    _reqBytes++; _sentBytes++;
+    _in->writeCommand(c);
+    return;
+  }
+  _reqBytes++;
+
+  // Continue the running stream if its pointer sits exactly at
+  // the start of the requested window (same columns, whole rows)
+  uint32_t rowBytes = (uint32_t)(_dCol1 - _dCol0 + 1) * 2;
+  if (_inStream && _dCol0 == _col0 && _dCol1 == _col1 &&
+      _stream % rowBytes == 0 && _streamRow + _stream / rowBytes == _dRow0)
+    return;
+
+  sendWindow();
+  _in->writeCommand(ST_RAMWR);
+  _sentBytes++;
+  _inStream  = true;
+  _streamRow = _row0;
+  _stream    = 0;
+}
+
+void CmdStreamBus::other() {
+  _inStream = false;
+}
+
+void CmdStreamBus::writeCommand16(uint16_t c) {
+  other();
+  _reqBytes += 2; _sentBytes += 2;
+  _in->writeCommand16(c);
+}
+
+void CmdStreamBus::writeCommandBytes(uint8_t* data, uint32_t len) {
+  other();
+  _reqBytes += len; _sentBytes += len;
+  _in->writeCommandBytes(data, len);
+}
+
+// ══════════════════════════════════════════════════════════
+//  FRAME BATCHING
+// ══════════════════════════════════════════════════════════
+
+void CmdStreamBus::beginWrite() {
+  if (_inFrame) return;
+  if (_depth++ == 0) _in->beginWrite();
+}
+
+void CmdStreamBus::endWrite() {
+  if (_inFrame) return;
+  if (_depth && --_depth == 0) _in->endWrite();
+}
+
+void CmdStreamBus::frameBegin() {
+  if (_inFrame) return;
+  _in->beginWrite();
+  _inFrame = true;
+}
+
+void CmdStreamBus::frameEnd() {
+  if (!_inFrame) return;
+  _inFrame = false;
+  _in->endWrite();
+
+  uint32_t now = millis();
+  if (now - _lastReport >= CMD_REPORT_MS && _reqBytes) {
+    _lastReport = now;
+    Serial.printf("[CMD] window/cmd bytes: %lu requested, %lu sent (%lu%% saved)\n",
+                  (unsigned long)_reqBytes, (unsigned long)_sentBytes,
+                  (unsigned long)((uint64_t)(_reqBytes - _sentBytes) * 100 / _reqBytes));
+  }
+}
+
+// ══════════════════════════════════════════════════════════
+//  PUBLIC
+// ══════════════════════════════════════════════════════════
+
+void cmdBusFrameBegin() {
+  if (activeBus) activeBus->frameBegin();
+}
+
+void cmdBusFrameEnd() {
+  if (activeBus) activeBus->frameEnd();
+}
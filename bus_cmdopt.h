@@ -0,0 +1,91 @@
+/*
+ * bus_cmdopt.h — ST7789 command-stream optimizer
+ * ────────────────────────────────────────────────
+ * A bus decorator between Arduino_ST7789 and the real bus.
+ * It tracks the panel's address window and write pointer and
+ * drops setup the panel doesn't need:
+ *
+ *   - RASET is sent with an open end row (CMD_ROW_END), so
+ *     once a window's rows are written the pointer simply
+ *     carries on into the next row.  A following window with
+ *     the same columns that starts exactly there (row-by-row
+ *     fillRect spans, banded bitmaps) needs no CASET, RASET or
+ *     RAMWR — its pixels extend the running RAMWR stream.
+ *   - Only the changed half of a window is ever re-sent.
+ *   - Between cmdBusFrameBegin()/End() the per-primitive
+ *     beginWrite/endWrite pairs collapse into one, so CS and
+ *     the SPI transaction stay open for the whole frame.
+ *
+ * Saved command bytes are logged as "[CMD] …" every
+ * CMD_REPORT_MS.  Enabled with PANEL_CMD_OPT in config.h.
+ */
+#pragma once
+
+#include "types.h"
+
+#define CMD_ROW_END    319      // last row of ST7789 frame memory
+#define CMD_REPORT_MS  10000
+
+class CmdStreamBus : public Arduino_DataBus {
+public:
+  explicit CmdStreamBus(Arduino_DataBus* inner);
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED,
+             int8_t dataMode = GFX_NOT_DEFINED) override {
+    return _in->begin(speed, dataMode);
+  }
+  void beginWrite() override;
+  void endWrite() override;
+
+  void writeCommand(uint8_t c) override;
+  void writeCommand16(uint16_t c) override;
+  void writeCommandBytes(uint8_t* data, uint32_t len) override;
+  void writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2) override;
+  void writeC8D16D16Split(uint8_t c, uint16_t d1, uint16_t d2) override;
+
+  void write(uint8_t d) override               { _stream += 1; _in->write(d); }
+  void write16(uint16_t d) override            { _stream += 2; _in->write16(d); }
+  void writeRepeat(uint16_t p, uint32_t len) override {
+    _stream += len * 2; _in->writeRepeat(p, len);
+  }
+  void writePixels(uint16_t* data, uint32_t len) override {
+    _stream += len * 2; _in->writePixels(data, len);
+  }
+  void writeBytes(uint8_t* data, uint32_t len) override {
+    _stream += len; _in->writeBytes(data, len);
+  }
+
+  void frameBegin();
+  void frameEnd();
+
+  uint32_t bytesRequested() const { return _reqBytes; }
+  uint32_t bytesSent() const      { return _sentBytes; }
+
+private:
+  void sendWindow();        // flush pending CASET/RASET
+  void other();             // any non-window command ends the stream
+
+  Arduino_DataBus* _in;
+
+  // Window as sent to the panel
+  bool     _haveCol = false, _haveRow = false;
+  uint16_t _col0 = 0, _col1 = 0, _row0 = 0;
+  // Window the driver believes is set (it skips CASET/RASET
+  // itself when unchanged, so this can differ from the above)
+  uint16_t _dCol0 = 0, _dCol1 = 0, _dRow0 = 0;
+
+  bool     _inStream  = false;   // RAMWR active
+  uint16_t _streamRow = 0;       // row the stream started on
+  uint32_t _stream    = 0;       // data bytes since RAMWR
+
+  bool     _inFrame = false;
+  uint8_t  _depth   = 0;
+
+  uint32_t _reqBytes  = 0;       // command bytes the driver asked for
+  uint32_t _sentBytes = 0;       // command bytes actually sent
+  uint32_t _lastReport = 0;
+};
+
+// Frame boundaries for the loop (no-ops without PANEL_CMD_OPT)
+void cmdBusFrameBegin();
+void cmdBusFrameEnd();
@@ -36,12 +36,51 @@
 #define SCREEN_W   240
 #define SCREEN_H   280
 
+// ── Display pipeline ──────────────────────────────────────
+// 1 = compose every frame in a 4bpp indexed framebuffer
+//     (33.6 KB heap, 16 colours per view) and push only the
+//     changed rows once per loop — no visible clear/redraw.
+// 0 = draw straight to the panel.
+#define FB_INDEXED       0
+// 1 = with FB_INDEXED, keep a shadow of the panel (+33.6 KB)
+//     and send only the spans that actually differ.
+#define FB_SHADOW_DIFF   0
+// 1 = queued SPI/DMA panel bus: draw calls return once queued
+//     and the transfer overlaps input + game physics.
+// 0 = blocking Arduino_HWSPI.
+#define PANEL_ASYNC_BUS  1
+// 1 = command-stream optimizer in front of the bus: elide
+//     redundant window setup, one CS/transaction per frame.
+#define PANEL_CMD_OPT    1
+// 1 = view switches slide via ST7789 hardware scrolling
+//     (only newly exposed rows are drawn each step).
+#define VIEW_SLIDE       1
+// 1 = star and maze playfields render into half-resolution
+//     canvases (¼ the pixels) that are 2× upscaled on push.
+#define PLAYFIELD_HALF_RES 0
+
+// ── Power ─────────────────────────────────────────────────
+// 1 = light-sleep the CPU between scheduled events (wakes on
+//     timer or BOOT button).  The USB console drops while it
+//     sleeps — use 0 for tethered debugging.
+#define POWER_LIGHT_SLEEP  1
+#define LIGHT_SLEEP_MIN_MS 5    // shorter waits just delay()
+// 1 = deep-sleep hibernation when idle (see power.h); hold
+//     BOOT for up to HIBERNATE_POLL_MS to wake.
+#define POWER_HIBERNATE    1
+#define HIBERNATE_SLEEP_MS 30000    // idle in sleep view
+#define HIBERNATE_IDLE_MS  300000   // idle in any non-game view
+#define HIBERNATE_POLL_MS  500      // wake-stub button check
+
 // ── Timing (ms) ───────────────────────────────────────────
-#define TARGET_FPS       60     // main loop frame rate cap
+#define TARGET_FPS       60     // continuous-view (tilt maze) frame rate
 #define FRAME_TIME_MS    (1000 / TARGET_FPS)  // ~16.67ms per frame
 #define ANIM_INTERVAL    600    // pet bob / blink cycle
 #define DECAY_INTERVAL   10000  // stat decay tick
 #define NOTIF_DURATION   2500   // notification display time
+#define SLIDE_MS         240    // view-switch scroll transition
+#define INPUT_POLL_MS    10     // button poll while pressed / in games
+#define INPUT_IDLE_MS    40     // button poll while idle
 // Button timing is handled by the OneButton library (defaults:
 // debounce 50 ms, click 400 ms, long-press 800 ms).
 
@@ -74,6 +74,37 @@ static void generateName(uint32_t seed, char* name) {
     name[pos] = '\0';
 }
 
+// ══════════════════════════════════════════════════════════════
+//  ELLIPSE SPAN TABLES
+// ══════════════════════════════════════════════════════════════
+//  Rows r and -r share a half-width, and runs of equal
+//  half-width collapse into one span: the centre run becomes a
+//  single span straddling y=0, every other run a mirrored pair.
+
+static uint8_t buildSpans(int rx, int ry, int yOff, PetSpan* out) {
+    int hw[16];
+    float rySq = (float)(ry * ry);
+    for (int r = 0; r <= ry; r++)
+        hw[r] = (int)(rx * sqrtf(1.0f - (float)(r * r) / rySq) + 0.5f);
+
+    uint8_t n = 0;
+    int a = 0;
+    while (a <= ry) {
+        int b = a;
+        while (b < ry && hw[b + 1] == hw[a]) b++;
+        if (hw[a] > 0) {
+            if (a == 0) {
+                out[n++] = { (int8_t)(yOff - b), (uint8_t)(2 * b + 1), (uint8_t)hw[a] };
+            } else {
+                out[n++] = { (int8_t)(yOff + a), (uint8_t)(b - a + 1), (uint8_t)hw[a] };
+                out[n++] = { (int8_t)(yOff - b), (uint8_t)(b - a + 1), (uint8_t)hw[a] };
+            }
+        }
+        a = b + 1;
+    }
+    return n;
+}
+
 // ══════════════════════════════════════════════════════════════
 //  INIT — derive all traits from chip seed
 // ══════════════════════════════════════════════════════════════
@@ -90,6 +121,10 @@ void creatureInit(uint32_t chipSeed) {
     d.bodyHeight = (hashTrait(chipSeed, 1) % 5) + 8;    // 8-12
     d.bellySize  = (hashTrait(chipSeed, 2) % 4) + 3;    // 3-6
 
+    // Belly is centred one row below the body centre
+    d.bodySpanCount  = buildSpans(d.bodyWidth, d.bodyHeight, 0, d.bodySpans);
+    d.bellySpanCount = buildSpans(d.bellySize, d.bellySize,  1, d.bellySpans);
+
     // ── Colors ────────────────────────────────────────────
     d.baseHue   = hashTrait(chipSeed, 3) % 360;
     d.accentHue = (d.baseHue + 90 + hashTrait(chipSeed, 4) % 180) % 360;
@@ -128,6 +163,7 @@ void creatureInit(uint32_t chipSeed) {
     d.energyMod = (int8_t)((int)(hashTrait(chipSeed, 18) % 21) - 10);
 
     // ── Initial color computation ─────────────────────────
+    d.visualGen++;              // new shape invalidates cached art
     creatureUpdateTime(0);
 
     Serial.print("Creature: ");
@@ -160,20 +196,34 @@ void creatureUpdateTime(uint32_t nowMs) {
     uint16_t ah = (d.accentHue + 360 + hueDrift / 2) % 360;
 
     // Body: saturated, medium-bright
-    d.bodyColor   = hsvToRgb565(h,  210, 230);
+    uint16_t body   = hsvToRgb565(h,  210, 230);
     // Belly: lighter (low saturation, high value)
-    d.bellyColor  = hsvToRgb565(h,  100, 250);
+    uint16_t belly  = hsvToRgb565(h,  100, 250);
     // Accent: complementary hue
-    d.accentColor = hsvToRgb565(ah, 190, 240);
+    uint16_t accent = hsvToRgb565(ah, 190, 240);
     // Spots: slightly offset darker shade
-    d.spotColor   = hsvToRgb565((h + 30) % 360, 230, 150);
+    uint16_t spot   = hsvToRgb565((h + 30) % 360, 230, 150);
 
     // ── Sparkle: repositions every ~2 minutes ─────────────
     uint32_t sparklePhase = nowMs / 120000;
     uint32_t sh = hashTrait(d.seed, 1000 + sparklePhase);
     int maxSX = max(1, (int)d.bodyWidth  - 2);
     int maxSY = max(1, (int)d.bodyHeight - 2);
-    d.sparkleX       = (int8_t)((int)(sh % (maxSX * 2 + 1)) - maxSX);
-    d.sparkleY       = (int8_t)((int)((sh >> 8) % (maxSY * 2 + 1)) - maxSY);
-    d.sparkleVisible = ((sh >> 16) % 3) == 0;   // visible ⅓ of intervals
+    int8_t sx  = (int8_t)((int)(sh % (maxSX * 2 + 1)) - maxSX);
+    int8_t sy  = (int8_t)((int)((sh >> 8) % (maxSY * 2 + 1)) - maxSY);
+    bool   vis = ((sh >> 16) % 3) == 0;   // visible ⅓ of intervals
+
+    // ── Publish (only bump visualGen on an actual change) ─
+    if (body != d.bodyColor || belly != d.bellyColor ||
+        accent != d.accentColor || spot != d.spotColor ||
+        sx != d.sparkleX || sy != d.sparkleY || vis != d.sparkleVisible) {
+        d.bodyColor      = body;
+        d.bellyColor     = belly;
+        d.accentColor    = accent;
+        d.spotColor      = spot;
+        d.sparkleX       = sx;
+        d.sparkleY       = sy;
+        d.sparkleVisible = vis;
+        d.visualGen++;
+    }
 }
@@ -9,6 +9,19 @@
 
 #include <Arduino.h>
 
+// ── Scanline span (precomputed ellipse rows) ────────────────
+// Covers rows [y0, y0 + rows) relative to the shape centre, all
+// with the same half-width.  Scale-1 units: the renderer
+// multiplies by its pixel scale, so one table serves every size.
+struct PetSpan {
+    int8_t  y0;
+    uint8_t rows;
+    uint8_t halfW;
+};
+
+#define CREATURE_BODY_SPANS   25   // 2 * max bodyHeight + 1
+#define CREATURE_BELLY_SPANS  13   // 2 * max bellySize  + 1
+
 // ── Creature DNA (all traits derived from seed) ─────────────
 struct CreatureDNA {
     // Identity
@@ -32,6 +45,12 @@ struct CreatureDNA {
     uint8_t feetStyle;          // 0=round, 1=small, 2=wide
     uint8_t feetSpacing;        // Half-distance from center: 2-4
 
+    // Body / belly ellipses as merged spans (built by creatureInit)
+    PetSpan bodySpans[CREATURE_BODY_SPANS];
+    uint8_t bodySpanCount;
+    PetSpan bellySpans[CREATURE_BELLY_SPANS];
+    uint8_t bellySpanCount;
+
     // Markings
     uint8_t spotCount;          // 0-3
     int8_t  spotX[3];           // X offsets from body center
@@ -56,6 +75,10 @@ struct CreatureDNA {
     int8_t  sparkleX;
     int8_t  sparkleY;
     bool    sparkleVisible;
+
+    // Bumped whenever creatureUpdateTime changes any colour or
+    // the sparkle, so renderers can tell when cached art is stale
+    uint16_t visualGen;
 };
 
 extern CreatureDNA creatureDNA;
@@ -0,0 +1,319 @@
+/*
+ * fb_indexed.cpp — 4bpp indexed off-screen framebuffer
+ * ──────────────────────────────────────────────────────
+ * Two pixels per byte, even x in the high nibble.  Each row
+ * tracks its dirty x-extent; flush pushes bands of dirty rows
+ * as single windows, expanding two pixels per byte through a
+ * 256-entry pair table rebuilt whenever the palette changes.
+ */
+#include "fb_indexed.h"
+
+#define FB_ROW_BYTES  (SCREEN_W / 2)
+
+// ══════════════════════════════════════════════════════════
+//  PALETTE
+// ══════════════════════════════════════════════════════════
+
+static uint16_t palette[FB_PALETTE_SIZE];
+static uint8_t  paletteCount = 0;
+static uint32_t pairLut[256];          // byte → two RGB565 pixels
+static bool     lutDirty     = true;
+static uint16_t lastColor    = 0;
+static uint8_t  lastIndex    = 0;
+static bool     lastValid    = false;
+
+// Squared RGB565 distance (channels weighted to equal bit depth)
+static uint32_t colorDist(uint16_t a, uint16_t b) {
+  int dr = (int)(a >> 11) - (int)(b >> 11);
+  int dg = ((int)((a >> 5) & 0x3F) - (int)((b >> 5) & 0x3F)) / 2;
+  int db = (int)(a & 0x1F) - (int)(b & 0x1F);
+  return dr * dr + dg * dg + db * db;
+}
+
+static uint8_t colorIndex(uint16_t c) {
+  if (lastValid && c == lastColor) return lastIndex;
+
+  uint8_t idx = 0;
+  bool found = false;
+  for (uint8_t i = 0; i < paletteCount; i++) {
+    if (palette[i] == c) { idx = i; found = true; break; }
+  }
+  if (!found) {
+    if (paletteCount < FB_PALETTE_SIZE) {
+      idx = paletteCount;
+      palette[paletteCount++] = c;
+      lutDirty = true;
+    } else {
+      uint32_t best = UINT32_MAX;
+      for (uint8_t i = 0; i < paletteCount; i++) {
+        uint32_t d = colorDist(palette[i], c);
+        if (d < best) { best = d; idx = i; }
+      }
+    }
+  }
+  lastColor = c;
+  lastIndex = idx;
+  lastValid = true;
+  return idx;
+}
+
+static void rebuildLut() {
+  for (int b = 0; b < 256; b++)
+    pairLut[b] = (uint32_t)palette[b >> 4] | ((uint32_t)palette[b & 0x0F] << 16);
+  lutDirty = false;
+}
+
+// ══════════════════════════════════════════════════════════
+//  FRAMEBUFFER GFX
+// ══════════════════════════════════════════════════════════
+
+class IndexedFB : public Arduino_GFX {
+public:
+  IndexedFB(Arduino_GFX* panel)
+    : Arduino_GFX(SCREEN_W, SCREEN_H), _panel(panel) {}
+
+  bool begin(int32_t) override {
+    _buf = (uint8_t*)malloc(FB_ROW_BYTES * SCREEN_H);
+    if (!_buf) return false;
+    memset(_buf, 0, FB_ROW_BYTES * SCREEN_H);
+    for (int16_t row = 0; row < SCREEN_H; row++) {
+      _dirtyX0[row] = SCREEN_W;
+      _dirtyX1[row] = 0;
+    }
+    markDirty(0, 0, SCREEN_W, SCREEN_H);
+#if FB_SHADOW_DIFF
+    // Without room for the shadow, every dirty row is sent as-is
+    _shadow = (uint8_t*)malloc(FB_ROW_BYTES * SCREEN_H);
+    invalidateShadow();
+#endif
+    return true;
+  }
+
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override {
+    setNibble(x, y, colorIndex(color));
+    markDirty(x, y, 1, 1);
+  }
+
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h,
+                               uint16_t color) override {
+    uint8_t idx = colorIndex(color);
+    for (int16_t row = y; row < y + h; row++) fillSpan(x, row, w, idx);
+    markDirty(x, y, w, h);
+  }
+
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+    int16_t h = 1;
+    if (clip(x, y, w, h)) writeFillRectPreclipped(x, y, w, 1, color);
+  }
+
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+    int16_t w = 1;
+    if (clip(x, y, w, h)) writeFillRectPreclipped(x, y, 1, h, color);
+  }
+
+  void fillScreen(uint16_t color) override {
+    uint8_t idx = colorIndex(color);
+    memset(_buf, (idx << 4) | idx, FB_ROW_BYTES * SCREEN_H);
+    markDirty(0, 0, SCREEN_W, SCREEN_H);
+  }
+
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap,
+                          int16_t w, int16_t h) override {
+    int16_t cx = x, cy = y, cw = w, ch = h;
+    if (!clip(cx, cy, cw, ch)) return;
+    for (int16_t row = cy; row < cy + ch; row++) {
+      const uint16_t* src = bitmap + (row - y) * w + (cx - x);
+      for (int16_t col = cx; col < cx + cw; col++)
+        setNibble(col, row, colorIndex(*src++));
+    }
+    markDirty(cx, cy, cw, ch);
+  }
+
+  void flush();
+  void invalidateShadow() { memset(_shadowRow, 0, sizeof(_shadowRow)); }
+  Arduino_GFX* panelGfx() { return _panel; }
+
+private:
+  // Clip a rect to the screen; false if nothing remains
+  bool clip(int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > SCREEN_W) w = SCREEN_W - x;
+    if (y + h > SCREEN_H) h = SCREEN_H - y;
+    return w > 0 && h > 0;
+  }
+
+  inline void setNibble(int16_t x, int16_t y, uint8_t idx) {
+    uint8_t& b = _buf[y * FB_ROW_BYTES + (x >> 1)];
+    b = (x & 1) ? ((b & 0xF0) | idx) : ((b & 0x0F) | (idx << 4));
+  }
+
+  void fillSpan(int16_t x, int16_t y, int16_t w, uint8_t idx) {
+    int16_t x1 = x + w;
+    if (x & 1)  { setNibble(x, y, idx); x++; }
+    if (x1 & 1) { x1--; setNibble(x1, y, idx); }
+    if (x1 > x)
+      memset(&_buf[y * FB_ROW_BYTES + (x >> 1)], (idx << 4) | idx, (x1 - x) >> 1);
+  }
+
+  void markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+    for (int16_t row = y; row < y + h; row++) {
+      if (x < _dirtyX0[row])     _dirtyX0[row] = x;
+      if (x + w > _dirtyX1[row]) _dirtyX1[row] = x + w;
+    }
+  }
+
+  void diffRows();
+  void pushRow(int16_t y, int16_t x0, int16_t x1);
+
+  Arduino_GFX* _panel;
+  uint8_t*     _buf = nullptr;
+  uint8_t*     _shadow = nullptr;      // what the panel shows (FB_SHADOW_DIFF)
+  bool         _shadowRow[SCREEN_H];   // row fully matches the panel
+  int16_t      _dirtyX0[SCREEN_H];   // inclusive; X0 >= X1 → clean
+  int16_t      _dirtyX1[SCREEN_H];   // exclusive
+};
+
+// ══════════════════════════════════════════════════════════
+//  FLUSH
+// ══════════════════════════════════════════════════════════
+
+static uint16_t lineBuf[FB_LINE_PX] __attribute__((aligned(4)));
+
+// ── Shadow diff ──────────────────────────────────────────
+// Compare each dirty row with the shadow of what the panel
+// already shows and shrink it to the bytes that differ.  Runs
+// closer than FB_DIFF_GAP_BYTES are merged (a new window costs
+// more than re-sending a few equal pixels); a row left with
+// several runs pushes each as its own window right here.
+
+#define FB_DIFF_MAX_RUNS  4
+
+void IndexedFB::pushRow(int16_t y, int16_t x0, int16_t x1) {
+  const uint8_t* src = &_buf[y * FB_ROW_BYTES + (x0 >> 1)];
+  uint32_t* out = (uint32_t*)lineBuf;
+  for (int16_t i = 0; i < ((x1 - x0) >> 1); i++) *out++ = pairLut[*src++];
+  _panel->draw16bitRGBBitmap(x0, y, lineBuf, x1 - x0, 1);
+}
+
+void IndexedFB::diffRows() {
+  for (int16_t row = 0; row < SCREEN_H; row++) {
+    if (_dirtyX0[row] >= _dirtyX1[row]) continue;
+
+    uint8_t*       sh  = &_shadow[row * FB_ROW_BYTES];
+    const uint8_t* cur = &_buf[row * FB_ROW_BYTES];
+    int b0 = _dirtyX0[row] >> 1;
+    int b1 = (_dirtyX1[row] + 1) >> 1;
+
+    if (!_shadowRow[row]) {        // panel contents unknown: send all
+      memcpy(sh + b0, cur + b0, b1 - b0);
+      // Known again only once the whole row has been resent
+      if (b0 == 0 && b1 == FB_ROW_BYTES) _shadowRow[row] = true;
+      continue;
+    }
+
+    int runs = 0;
+    int r0[FB_DIFF_MAX_RUNS], r1[FB_DIFF_MAX_RUNS];
+    int b = b0;
+    while (b < b1) {
+      while (b < b1 && cur[b] == sh[b]) b++;
+      if (b == b1) break;
+      int start = b, last = b;
+      while (b < b1 && b - last <= FB_DIFF_GAP_BYTES) {
+        if (cur[b] != sh[b]) last = b;
+        b++;
+      }
+      if (runs < FB_DIFF_MAX_RUNS) { r0[runs] = start; r1[runs++] = last + 1; }
+      else                         { r1[runs - 1] = last + 1; }
+    }
+    memcpy(sh + b0, cur + b0, b1 - b0);
+
+    if (runs == 1) {
+      _dirtyX0[row] = r0[0] * 2;
+      _dirtyX1[row] = r1[0] * 2;
+      continue;
+    }
+    for (int i = 0; i < runs; i++) pushRow(row, r0[i] * 2, r1[i] * 2);
+    _dirtyX0[row] = SCREEN_W;     // identical (0 runs) or sent above
+    _dirtyX1[row] = 0;
+  }
+}
+
+void IndexedFB::flush() {
+  if (lutDirty) rebuildLut();
+  if (_shadow) diffRows();
+
+  int16_t y = 0;
+  while (y < SCREEN_H) {
+    if (_dirtyX0[y] >= _dirtyX1[y]) { y++; continue; }
+
+    // Grow a band of consecutive dirty rows under one x-extent,
+    // aligned to even pixels so each source byte expands whole
+    int16_t x0 = _dirtyX0[y] & ~1;
+    int16_t x1 = (_dirtyX1[y] + 1) & ~1;
+    int16_t y1 = y + 1;
+    while (y1 < SCREEN_H && _dirtyX0[y1] < _dirtyX1[y1]) {
+      int16_t nx0 = min(x0, (int16_t)(_dirtyX0[y1] & ~1));
+      int16_t nx1 = max(x1, (int16_t)((_dirtyX1[y1] + 1) & ~1));
+      if ((int32_t)(nx1 - nx0) * (y1 - y + 1) > FB_LINE_PX) break;
+      x0 = nx0; x1 = nx1; y1++;
+    }
+
+    int16_t w = x1 - x0;
+    uint32_t* out = (uint32_t*)lineBuf;
+    for (int16_t row = y; row < y1; row++) {
+      const uint8_t* src = &_buf[row * FB_ROW_BYTES + (x0 >> 1)];
+      for (int16_t i = 0; i < (w >> 1); i++) *out++ = pairLut[*src++];
+      _dirtyX0[row] = SCREEN_W;
+      _dirtyX1[row] = 0;
+    }
+    _panel->draw16bitRGBBitmap(x0, y, lineBuf, w, y1 - y);
+    y = y1;
+  }
+}
+
+// ══════════════════════════════════════════════════════════
+//  PUBLIC
+// ══════════════════════════════════════════════════════════
+
+static IndexedFB* fb = nullptr;
+
+bool fbInit() {
+  IndexedFB* f = new IndexedFB(gfx);
+  if (!f->begin(GFX_NOT_DEFINED)) {
+    delete f;
+    Serial.println("[FB] Not enough heap for 4bpp framebuffer — drawing direct");
+    return false;
+  }
+  fb  = f;
+  gfx = f;
+  fbPaletteReset(COL_BG_MAIN);
+  return true;
+}
+
+bool fbActive() {
+  return fb != nullptr;
+}
+
+void fbPaletteReset(uint16_t bg) {
+  if (!fb) return;
+  // Shared colours every view (and notifications) rely on
+  static const uint16_t fixed[] = {
+    COL_WHITE, COL_BLACK, COL_YELLOW, COL_DIM, COL_DARK
+  };
+  fb->invalidateShadow();   // indices are about to change meaning
+  paletteCount = 0;
+  palette[paletteCount++] = bg;
+  for (uint16_t c : fixed)
+    if (c != bg) palette[paletteCount++] = c;
+  lastValid = false;
+  lutDirty  = true;
+}
+
+void fbFlush() {
+  if (fb) fb->flush();
+}
+
+Arduino_GFX* fbPanel() {
+  return fb ? fb->panelGfx() : gfx;
+}
@@ -0,0 +1,48 @@
+/*
+ * fb_indexed.h — 4bpp indexed off-screen framebuffer
+ * ────────────────────────────────────────────────────
+ * A full 240×280 frame at 4 bits per pixel (33.6 KB) that
+ * stands in for the panel as `gfx`, so every ui_* view draws
+ * into it unchanged.  fbFlush() expands only the changed rows
+ * through a 16-entry RGB565 palette while streaming them to
+ * the ST7789 — composition happens off-screen, so the panel
+ * never shows a half-drawn (cleared-then-redrawn) frame.
+ *
+ * Palette: reset per full view draw with the view background
+ * and the shared UI colours; further colours are allocated on
+ * first use, and once all 16 slots are taken a colour maps to
+ * its nearest entry.
+ *
+ * With FB_SHADOW_DIFF a second 4bpp copy shadows what the
+ * panel already shows; each dirty row is diffed against it and
+ * only the differing spans are sent, so redraws that repaint
+ * identical pixels cost no SPI traffic.  A palette reset
+ * forgets the shadow row by row: a row is diffed again only
+ * after it has been resent in full (a slide resends the view
+ * strip by strip, long after the first flush).
+ *
+ * Enabled with FB_INDEXED in config.h.  All functions are safe
+ * no-ops when the framebuffer is not active.
+ */
+#pragma once
+
+#include "types.h"
+
+#define FB_PALETTE_SIZE  16
+#define FB_LINE_PX       (SCREEN_W * 16)   // expansion buffer (px)
+#define FB_DIFF_GAP_BYTES 6                // merge diff runs closer than this
+
+// Allocate the framebuffer and install it as gfx.  On failure
+// (low heap) gfx is left pointing at the panel.
+bool fbInit();
+
+bool fbActive();
+
+// Start a new palette for a full redraw of a view with bg
+void fbPaletteReset(uint16_t bg);
+
+// Push all changed rows to the panel
+void fbFlush();
+
+// The real display (gfx itself when the framebuffer is inactive)
+Arduino_GFX* fbPanel();
@@ -0,0 +1,131 @@
+/*
+ * frame_gov.cpp — Per-view frame-rate governor
+ * ──────────────────────────────────────────────
+ */
+#include "frame_gov.h"
+#include "sched.h"
+#include "game_rhythm.h"
+#include "input.h"
+
+#define VIEW_COUNT  (VIEW_SLEEP + 1)
+
+static const FrameMode VIEW_MODE[VIEW_COUNT] = {
+  FRAME_ANIM,         // VIEW_MAIN
+  FRAME_EVENT,        // VIEW_FEED
+  FRAME_ANIM,         // VIEW_PLAY
+  FRAME_BEAT,         // VIEW_PLAY_RHYTHM
+  FRAME_CONTINUOUS,   // VIEW_PLAY_BALANCE
+  FRAME_EVENT,        // VIEW_STATUS
+  FRAME_ANIM,         // VIEW_SLEEP
+};
+
+static const char* const VIEW_NAME[VIEW_COUNT] = {
+  "MAIN", "FEED", "PLAY", "RHYTHM", "BALANCE", "STATUS", "SLEEP"
+};
+
+static int8_t   taskInput  = -1;
+static int8_t   taskGame   = -1;
+static uint32_t boostUntil = 0;
+static View     lastView   = VIEW_MAIN;
+static uint32_t seenClick  = 0;
+
+static uint32_t wakes[VIEW_COUNT];
+static uint32_t dwellMs[VIEW_COUNT];
+static uint32_t sleptMs[VIEW_COUNT];
+static uint32_t lastWake   = 0;
+static uint32_t lastReport = 0;
+
+// Running totals since a cold boot: RTC memory keeps them through
+// hibernation, and the status view shows them without a console
+RTC_DATA_ATTR static uint64_t totalDwellMs[VIEW_COUNT];
+RTC_DATA_ATTR static uint64_t totalSleptMs[VIEW_COUNT];
+
+FrameMode govMode(View v) {
+  return (v < VIEW_COUNT) ? VIEW_MODE[v] : FRAME_ANIM;
+}
+
+uint8_t govAnimMask() {
+  uint8_t mask = 0;
+  for (int v = 0; v < VIEW_COUNT; v++)
+    if (VIEW_MODE[v] != FRAME_EVENT) mask |= VIEW_BIT(v);
+  return mask;
+}
+
+void govInit(int8_t inputTask, int8_t gameTask) {
+  taskInput = inputTask;
+  taskGame  = gameTask;
+  lastWake  = lastReport = millis();
+}
+
+// ══════════════════════════════════════════════════════════
+//  CADENCE
+// ══════════════════════════════════════════════════════════
+
+void govOnInput(bool active) {
+  uint32_t now = millis();
+  FrameMode m  = govMode(currentView);
+
+  if (active) boostUntil = now + GOV_BOOST_MS;
+  bool boosted = (int32_t)(boostUntil - now) > 0;
+
+  // New view, or a tap the beat game must score: step it now
+  if (currentView != lastView ||
+      (m == FRAME_BEAT && lastClickTime != seenClick)) {
+    schedAfter(taskGame, 0);
+  }
+  lastView  = currentView;
+  seenClick = lastClickTime;
+
+  bool fast = boosted || m == FRAME_CONTINUOUS || m == FRAME_BEAT;
+  schedSetPeriod(taskInput, fast ? INPUT_POLL_MS : INPUT_IDLE_MS);
+}
+
+void govOnGameStep() {
+  if (govMode(currentView) != FRAME_BEAT) return;   // fixed FRAME_TIME_MS
+
+  uint32_t now  = millis();
+  uint32_t beat = rhythmGameNextBeatTime();
+  int32_t  wait = beat ? (int32_t)(beat - now) : GOV_IDLE_MS;
+  schedAfter(taskGame, wait > 0 ? wait : 0);
+}
+
+// ══════════════════════════════════════════════════════════
+//  STATS
+// ══════════════════════════════════════════════════════════
+
+void govCountWake() {
+  uint32_t now = millis();
+  if (currentView < VIEW_COUNT) {
+    wakes[currentView]++;
+    dwellMs[currentView]      += now - lastWake;
+    totalDwellMs[currentView] += now - lastWake;
+  }
+  lastWake = now;
+
+  if (now - lastReport < SCHED_REPORT_MS) return;
+  lastReport = now;
+  for (int v = 0; v < VIEW_COUNT; v++) {
+    if (!dwellMs[v]) continue;
+    Serial.printf("[GOV] %-7s %lu wakes/min  asleep %lu%%  over %lus\n",
+                  VIEW_NAME[v],
+                  (unsigned long)((uint64_t)wakes[v] * 60000 / dwellMs[v]),
+                  (unsigned long)((uint64_t)sleptMs[v] * 100 / dwellMs[v]),
+                  (unsigned long)(dwellMs[v] / 1000));
+    wakes[v] = dwellMs[v] = sleptMs[v] = 0;
+  }
+}
+
+void govCountSleep(uint32_t ms) {
+  if (currentView >= VIEW_COUNT) return;
+  sleptMs[currentView]      += ms;
+  totalSleptMs[currentView] += ms;
+}
+
+uint8_t govAsleepPct() {
+  uint64_t dwell = 0, slept = 0;
+  for (int v = 0; v < VIEW_COUNT; v++) {
+    dwell += totalDwellMs[v];
+    slept += totalSleptMs[v];
+  }
+  return dwell ? (uint8_t)(slept * 100 / dwell) : 0;
+}
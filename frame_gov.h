@@ -0,0 +1,58 @@
+/*
+ * frame_gov.h — Per-view frame-rate governor
+ * ────────────────────────────────────────────
+ * Each view declares how often it actually changes, and the
+ * governor sets the scheduler cadences from that:
+ *
+ *   FRAME_CONTINUOUS  game + input every frame   (tilt maze)
+ *   FRAME_BEAT        game wakes on beat edges   (rhythm)
+ *   FRAME_ANIM        anim tick only             (main, sleep, star)
+ *   FRAME_EVENT       input only, no anim tick   (feed, status)
+ *
+ * Outside the continuous / beat views input is polled at
+ * INPUT_IDLE_MS, but any button activity ramps it straight back
+ * to INPUT_POLL_MS for GOV_BOOST_MS so clicks stay snappy.
+ * Loop wakes and light-sleep residency per view are logged as
+ * "[GOV] ..." with the scheduler report.  The USB console drops
+ * under light sleep, so running totals are also kept in RTC
+ * memory (they survive hibernation) and the status view shows
+ * the overall share asleep.
+ */
+#pragma once
+
+#include "types.h"
+
+#define GOV_BOOST_MS   1000   // fast input polling after activity
+#define GOV_IDLE_MS    250    // beat game re-check while no round runs
+
+enum FrameMode : uint8_t {
+  FRAME_CONTINUOUS,
+  FRAME_BEAT,
+  FRAME_ANIM,
+  FRAME_EVENT
+};
+
+FrameMode govMode(View v);
+
+// Views that need the anim tick (scheduler view mask)
+uint8_t govAnimMask();
+
+// Hand over the tasks whose cadence the governor owns
+void govInit(int8_t inputTask, int8_t gameTask);
+
+// After each input poll: `active` = a press is in progress.
+// Also steps the game at once on a view switch or beat-game tap.
+void govOnInput(bool active);
+
+// After each game step: pick when the game task runs next
+void govOnGameStep();
+
+// Once per loop pass (wake accounting)
+void govCountWake();
+
+// Time just spent in light sleep (power.cpp)
+void govCountSleep(uint32_t ms);
+
+// Share of awake time spent in light sleep since a cold boot
+// (carried across hibernation), 0-100
+uint8_t govAsleepPct();
@@ -5,6 +5,7 @@
  */
 #include "game_balance.h"
 #include "mpu6050.h"
+#include "asset_pak.h"
 
 // Global game state (allocate dynamically)
 BalanceGameState* balanceGame = nullptr;
@@ -17,11 +18,25 @@ BalanceGameState* balanceGame = nullptr;
 #define BALL_SIZE     4       // Radius in game units
 #define CELL_SIZE     10      // Size of maze cells in game units
 
-// Per-level parameters (index 0 = level 1)
-static const int LEVEL_WALL_COUNTS[5] = { 10, 15, 20, 30, 40 };
-static const int LEVEL_TIME_LIMITS[5] = { 35000, 30000, 27000, 24000, 20000 };
-static const int WALL_DRAW_W[5]       = { 20, 16, 12,  8,  5 };
-static const int WALL_DRAW_H[5]       = { 18, 14, 10,  7,  5 };
+// Per-level parameters (index 0 = level 1).  Same layout as the
+// MAZE_LEVELS table in the asset partition, which wins when flashed.
+struct LevelDef {
+  int32_t walls, timeMs, wallDrawW, wallDrawH;
+};
+
+static const LevelDef BUILTIN_LEVELS[BALANCE_MAX_LEVEL] = {
+  { 10, 35000, 20, 18 },
+  { 15, 30000, 16, 14 },
+  { 20, 27000, 12, 10 },
+  { 30, 24000,  8,  7 },
+  { 40, 20000,  5,  5 },
+};
+
+static const LevelDef& levelDef(int level) {
+  const LevelDef* pak = (const LevelDef*)pakTableI32(
+      PAK_MAZE_LEVELS, BALANCE_MAX_LEVEL * 4);
+  return (pak ? pak : BUILTIN_LEVELS)[level - 1];
+}
 
 // ══════════════════════════════════════════════════════════
 //  MAZE GENERATION
@@ -37,7 +52,7 @@ static void generateMaze(int level) {
     }
   }
 
-  int wallCount = LEVEL_WALL_COUNTS[level - 1];
+  int wallCount = levelDef(level).walls;
 
   randomSeed(millis());
   for (int i = 0; i < wallCount; i++) {
@@ -108,7 +123,7 @@ void balanceGameStartLevel(int level) {
   balanceGame->level        = level;
   balanceGame->difficulty   = (level <= 2) ? BALANCE_EASY :
                               (level <= 4) ? BALANCE_MEDIUM : BALANCE_HARD;
-  balanceGame->levelTimeLimit = LEVEL_TIME_LIMITS[level - 1];
+  balanceGame->levelTimeLimit = levelDef(level).timeMs;
   balanceGame->levelComplete  = false;
   balanceGame->levelFailed    = false;
   balanceGame->levelStartTime = millis();
@@ -299,6 +314,6 @@ const uint8_t* balanceGameGetMazePattern() {
 
 void balanceGameGetWallDrawSize(int& w, int& h) {
   int lvl = constrain(balanceGame->level, 1, BALANCE_MAX_LEVEL);
-  w = WALL_DRAW_W[lvl - 1];
-  h = WALL_DRAW_H[lvl - 1];
+  w = levelDef(lvl).wallDrawW;
+  h = levelDef(lvl).wallDrawH;
 }
@@ -5,6 +5,7 @@
  */
 #include "game_rhythm.h"
 #include "input.h"
+#include "asset_pak.h"
 
 // Global game state (defaults from struct definition in types.h)
 RhythmGameState rhythmGame;
@@ -13,8 +14,9 @@ RhythmGameState rhythmGame;
 // Round 0: Easy (1000ms)
 // Round 1: Medium (800ms)
 // Round 2: Hard (600ms)
-static const uint16_t BEAT_INTERVALS[] = {1000, 800, 600};
+// The RHYTHM_BEATS table in the asset partition wins when flashed.
 static const uint8_t NUM_ROUNDS = 3;
+static const uint16_t BEAT_INTERVALS[NUM_ROUNDS] = {1000, 800, 600};
 static const uint8_t BEATS_PER_ROUND = 10;
 
 // Scoring thresholds (ms)
@@ -74,7 +76,8 @@ static void rhythmGameStartRound() {
   rhythmGame.goodCount = 0;
   rhythmGame.missCount = 0;
   rhythmGame.roundStartTime = millis();
-  rhythmGame.beatInterval = BEAT_INTERVALS[rhythmGame.round];
+  const uint16_t* beats = pakTableU16(PAK_RHYTHM_BEATS, NUM_ROUNDS);
+  rhythmGame.beatInterval = (beats ? beats : BEAT_INTERVALS)[rhythmGame.round];
   rhythmGame.currentBeatProcessed = false;
   rhythmGame.feedbackAge = 0;
 
@@ -107,6 +110,13 @@ int rhythmGameGetCurrentBeatTime() {
   return rhythmGame.roundStartTime + expectedBeatTime;
 }
 
+uint32_t rhythmGameNextBeatTime() {
+  // Next moment the game state can change without a tap
+  if (rhythmGame.roundStartTime == 0 || rhythmGame.roundComplete) return 0;
+  return rhythmGame.roundStartTime +
+         (uint32_t)(rhythmGame.beatIndex + 1) * rhythmGame.beatInterval;
+}
+
 static void rhythmGameScoreTap(uint32_t clickTime, uint32_t beatTime) {
   // Score a button tap based on accuracy
   int accuracy = (int)clickTime - (int)beatTime;  // Positive = late, negative = early
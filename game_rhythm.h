@@ -17,3 +17,4 @@ void rhythmGameReset();             // Reset to round 1
 void rhythmGameUpdate();            // Called every frame to check beat timing
 bool rhythmGameCheckRoundComplete();  // Returns true if round/game is finished
 int  rhythmGameGetCurrentBeatTime(); // Returns expected time of current beat
+uint32_t rhythmGameNextBeatTime();   // millis() of the next beat boundary (0 = idle)
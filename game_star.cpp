@@ -4,6 +4,7 @@
  */
 #include "game_star.h"
 #include "ui_common.h"  // triggerNotif
+#include "pet.h"
 
 void starGameReset() {
   starGame.x         = (int)random(30, 190);
@@ -21,8 +22,7 @@ void starGameCatch() {
   if (starGame.score > starGame.bestScore)
     starGame.bestScore = starGame.score;
 
-  pet.happy  = (uint8_t)min(100, (int)pet.happy  + 3);
-  pet.energy = (uint8_t)max(0,   (int)pet.energy - 1);
+  petAdjust(+3, -1);
 
   char msg[28];
   sprintf(msg, "CAUGHT!  SCORE: %d", starGame.score);
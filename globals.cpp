@@ -23,10 +23,6 @@ StarGameState  starGame;
 int      animFrame     = 0;
 bool     viewDirty     = true;
 
-// ── Timing ────────────────────────────────────────────────
-uint32_t lastAnimTick  = 0;
-uint32_t lastDecayTick = 0;
-
 // ── Input cursors ─────────────────────────────────────────
 int      actionCursor  = 0;
 int      selectedFood  = 0;
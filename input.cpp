@@ -16,6 +16,7 @@ static OneButton* btn = nullptr;
 
 // ── Click timing (for rhythm game) ───────────────────────
 uint32_t lastClickTime = 0;  // Timestamp of most recent click (exported for games)
+static uint32_t lastActive = 0;
 
 // ── Callbacks ────────────────────────────────────────────
 static void onClick() {
@@ -47,4 +48,13 @@ void inputInit() {
 
 void inputUpdate() {
   btn->tick();
+  if (!btn->isIdle()) lastActive = millis();
+}
+
+bool inputIdle() {
+  return btn->isIdle();
+}
+
+uint32_t inputLastActive() {
+  return lastActive;
 }
@@ -19,6 +19,12 @@ void inputInit();
 // Call every loop() iteration
 void inputUpdate();
 
+// True while no press / click sequence is in progress
+bool inputIdle();
+
+// millis() of the last poll that saw button activity
+uint32_t inputLastActive();
+
 // ── Click timing (exported for games like Rhythm Tap) ────
 // Updated in onClick() handler; games read this to detect taps
 extern uint32_t lastClickTime;
@@ -17,6 +17,10 @@
 #include "ui_status.h"
 #include "ui_sleep.h"
 #include "ui_common.h"
+#include "ui_damage.h"
+#include "fb_indexed.h"
+#include "ui_slide.h"
+#include "panel_profile.h"
 
 // ══════════════════════════════════════════════════════════
 //  VIEW MANAGEMENT
@@ -35,9 +39,16 @@ uint16_t navViewBgColor() {
   }
 }
 
+// Set by navSwitchView; the next full draw slides instead of wiping
+static bool     slidePending = false;
+static SlideDir slideDir     = SLIDE_UP;
+
 void navSwitchView(View v) {
   previousView = currentView;
   currentView  = v;
+  if (previousView == VIEW_PLAY_BALANCE && v != VIEW_PLAY_BALANCE) {
+    uiPlayBalanceExit();
+  }
 
   // Initialize game state on view switch
   if (v == VIEW_PLAY) {
@@ -47,12 +58,17 @@ void navSwitchView(View v) {
     rhythmGameReset();
   } else if (v == VIEW_PLAY_BALANCE) {
     balanceGameReset();
+    uiPlayBalanceEnter();
   }
 
   selectedFood  = 0;
   notif.active  = false;
   notif.drawn   = false;
   viewDirty     = true;
+
+  // Going home slides back down; everything else rises in
+  slidePending  = VIEW_SLIDE && v != previousView;
+  slideDir      = (v == VIEW_MAIN) ? SLIDE_DOWN : SLIDE_UP;
 }
 
 // ══════════════════════════════════════════════════════════
@@ -60,19 +76,34 @@ void navSwitchView(View v) {
 // ══════════════════════════════════════════════════════════
 
 void navDrawFullView() {
+  petSync();       // stats are evaluated lazily, at draw time
+  damageClear();   // everything is about to be repainted
+  fbPaletteReset(navViewBgColor());
+  slideAbort();    // a new switch mid-slide just redraws
+
+  if (slidePending) {
+    slidePending = false;
+    slideStart(slideDir);   // rows are drawn as they scroll in
+    return;
+  }
   gfx->fillScreen(navViewBgColor());
+  navDrawView();
+}
+
+void navDrawView() {
   switch (currentView) {
     case VIEW_MAIN:          uiMainDraw();           break;
     case VIEW_FEED:          uiFeedDraw();           break;
     case VIEW_PLAY:          uiPlayDraw();           break;
     case VIEW_PLAY_RHYTHM:   uiPlayRhythmDraw();     break;
-    case VIEW_PLAY_BALANCE:  uiPlayBalanceDraw();         break;
+    case VIEW_PLAY_BALANCE:  uiPlayBalanceDraw();    break;
     case VIEW_STATUS:        uiStatusDraw();         break;
     case VIEW_SLEEP:         uiSleepDraw();          break;
   }
 }
 
 void navUpdateAnimation() {
+  petSync();
   switch (currentView) {
     case VIEW_MAIN:          uiMainAnimate();          break;
     case VIEW_SLEEP:         uiSleepAnimate();         break;
@@ -94,15 +125,19 @@ void navOnShortPressA() {
       uiMainDrawActionBar();   // partial redraw
       break;
 
-    case VIEW_FEED:
+    case VIEW_FEED: {
+      int prev = selectedFood;
       selectedFood = (selectedFood + 1) % 7;  // 6 foods + BACK
-      viewDirty = true;
+      uiFeedDamageCursor(prev, selectedFood);
       break;
+    }
 
-    case VIEW_PLAY:
+    case VIEW_PLAY: {
+      int oldX = starGame.x, oldY = starGame.y;
       starGameCatch();
-      viewDirty = true;
+      uiPlayUpdateStar(oldX, oldY);
       break;
+    }
 
     case VIEW_PLAY_RHYTHM:
       // Single tap in rhythm game is handled by rhythmGameUpdate() via click timestamp
@@ -176,8 +211,8 @@ void navOnShortPressB() {
       break;
 
     case VIEW_SLEEP:
-      petSetSleeping(false);
-      navSwitchView(VIEW_MAIN);
+      profileCycleSleep();     // applied by profileUpdate(), no redraw
+      uiSleepDrawProfile();
       break;
   }
 }
@@ -11,6 +11,7 @@
 // View management
 void     navSwitchView(View v);
 void     navDrawFullView();       // full redraw (on view switch)
+void     navDrawView();           // view content only, no clear
 void     navUpdateAnimation();    // partial redraw (per tick)
 uint16_t navViewBgColor();        // bg colour for current view
 
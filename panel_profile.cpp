@@ -0,0 +1,111 @@
+/*
+ * panel_profile.cpp — Display colour profiles (gamma + backlight)
+ * ─────────────────────────────────────────────────────────────────
+ * Gamma tables are 14 bytes per polarity; the stock set is the
+ * one Arduino_GFX programs at init.  Digital gamma tables map
+ * each of 64 input levels to an output level (identity = i*4).
+ */
+#include "panel_profile.h"
+
+#define ST_DGMEN     0xBA
+#define ST_PVGAMCTRL 0xE0
+#define ST_NVGAMCTRL 0xE1
+#define ST_DGMLUTR   0xE2
+#define ST_DGMLUTB   0xE3
+
+#define DGM_STEPS    64
+
+struct ProfileDef {
+  const char*    name;
+  const uint8_t* pgam;        // 14 bytes
+  const uint8_t* ngam;        // 14 bytes
+  uint8_t        redPct;      // digital gamma scale (100 = off)
+  uint8_t        bluePct;
+  uint8_t        backlight;   // PWM duty 0–255
+};
+
+static const uint8_t PGAM_STOCK[14] = {
+  0xD0, 0x04, 0x0D, 0x11, 0x13, 0x2B, 0x3F, 0x54, 0x4C, 0x18, 0x0D, 0x0B, 0x1F, 0x23 };
+static const uint8_t NGAM_STOCK[14] = {
+  0xD0, 0x04, 0x0C, 0x11, 0x13, 0x2C, 0x3F, 0x44, 0x51, 0x2F, 0x1F, 0x1F, 0x20, 0x23 };
+static const uint8_t PGAM_STEEP[14] = {
+  0xF0, 0x00, 0x0A, 0x10, 0x12, 0x1B, 0x39, 0x44, 0x47, 0x28, 0x12, 0x10, 0x16, 0x1B };
+static const uint8_t NGAM_STEEP[14] = {
+  0xF0, 0x00, 0x0A, 0x10, 0x11, 0x1A, 0x3B, 0x34, 0x4E, 0x3A, 0x17, 0x16, 0x21, 0x22 };
+
+static const ProfileDef PROFILES[PROFILE_COUNT] = {
+  { "DAY",      PGAM_STOCK, NGAM_STOCK, 100, 100, 255 },
+  { "DIM",      PGAM_STOCK, NGAM_STOCK, 100, 100,  70 },
+  { "NIGHT",    PGAM_STOCK, NGAM_STOCK,  90,  40,  24 },
+  { "CONTRAST", PGAM_STEEP, NGAM_STEEP, 100, 100, 255 },
+};
+
+static PanelProfile current    = PROFILE_DAY;
+static PanelProfile sleepPick  = PROFILE_NIGHT;
+static bool         applied    = false;
+
+// ── Register writes ──────────────────────────────────────
+static void sendTable(uint8_t cmd, const uint8_t* data, uint32_t len) {
+  bus->writeCommand(cmd);
+  bus->writeBytes((uint8_t*)data, len);
+}
+
+static void sendScaledLut(uint8_t cmd, uint8_t pct) {
+  uint8_t lut[DGM_STEPS];
+  for (int i = 0; i < DGM_STEPS; i++) lut[i] = (uint8_t)(i * 4 * pct / 100);
+  sendTable(cmd, lut, DGM_STEPS);
+}
+
+void profileApply(PanelProfile p) {
+  if (p >= PROFILE_COUNT) return;
+  const ProfileDef& d = PROFILES[p];
+  bool digital = d.redPct != 100 || d.bluePct != 100;
+
+  bus->beginWrite();
+  sendTable(ST_PVGAMCTRL, d.pgam, 14);
+  sendTable(ST_NVGAMCTRL, d.ngam, 14);
+  if (digital) {
+    sendScaledLut(ST_DGMLUTR, d.redPct);
+    sendScaledLut(ST_DGMLUTB, d.bluePct);
+  }
+  bus->writeC8D8(ST_DGMEN, digital ? 0x04 : 0x00);
+  bus->endWrite();
+
+  analogWrite(PIN_BL, d.backlight);
+  current = p;
+  applied = true;
+  Serial.printf("[PROFILE] %s\n", d.name);
+}
+
+// ══════════════════════════════════════════════════════════
+//  STATE / SCHEDULE
+// ══════════════════════════════════════════════════════════
+
+void profileInit() {
+#if POWER_LIGHT_SLEEP
+  // Backlight PWM must keep running through light sleep
+  ledcSetClockSource(LEDC_USE_RC_FAST_CLK);
+#endif
+  profileApply(PROFILE_DAY);
+}
+
+PanelProfile profileCurrent() {
+  return current;
+}
+
+const char* profileName(PanelProfile p) {
+  return (p < PROFILE_COUNT) ? PROFILES[p].name : "?";
+}
+
+void profileCycleSleep() {
+  sleepPick = (PanelProfile)((sleepPick + 1) % PROFILE_COUNT);
+}
+
+PanelProfile profileSleepChoice() {
+  return sleepPick;
+}
+
+void profileUpdate() {
+  PanelProfile want = pet.sleeping ? sleepPick : PROFILE_DAY;
+  if (!applied || want != current) profileApply(want);
+}
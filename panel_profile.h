@@ -0,0 +1,44 @@
+/*
+ * panel_profile.h — Display colour profiles (gamma + backlight)
+ * ───────────────────────────────────────────────────────────────
+ * A profile is applied by reprogramming the ST7789 itself —
+ * positive/negative gamma (PVGAMCTRL 0xE0 / NVGAMCTRL 0xE1),
+ * the red/blue digital gamma tables (DGMLUTR 0xE2 / DGMLUTB
+ * 0xE3, enabled via DGMEN in 0xBA) — plus the backlight PWM.
+ * Frame memory is untouched: no pixel is re-sent and no view
+ * redraws, so a switch is instant and costs ~150 bytes of SPI.
+ *
+ *   PROFILE_DAY       stock gamma, full backlight
+ *   PROFILE_DIM       stock gamma, low backlight
+ *   PROFILE_NIGHT     warm (blue/red LUTs pulled down), very dim
+ *   PROFILE_CONTRAST  steeper gamma curve, full backlight
+ *
+ * Schedule: profileUpdate() follows the pet — while it sleeps
+ * the profile chosen in the sleep view (default NIGHT) is
+ * active, otherwise DAY.
+ */
+#pragma once
+
+#include "types.h"
+
+enum PanelProfile : uint8_t {
+  PROFILE_DAY,
+  PROFILE_DIM,
+  PROFILE_NIGHT,
+  PROFILE_CONTRAST,
+  PROFILE_COUNT
+};
+
+// Take over the backlight pin (PWM) and apply DAY (after gfx->begin)
+void profileInit();
+
+void         profileApply(PanelProfile p);
+PanelProfile profileCurrent();
+const char*  profileName(PanelProfile p);
+
+// Sleep view: step the profile used while the pet sleeps
+void         profileCycleSleep();
+PanelProfile profileSleepChoice();
+
+// Called from loop: switch when the pet falls asleep / wakes
+void profileUpdate();
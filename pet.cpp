@@ -5,23 +5,40 @@
  * Returns notification strings via triggerNotif (from ui_common).
  */
 #include "pet.h"
+#include "pet_model.h"
 #include "creature_gen.h"
 #include "ui_common.h"   // triggerNotif
 
-// ── Stat decay / recovery ─────────────────────────────────
+// ── Stat model ────────────────────────────────────────────
+// Closed form in pet_model.h.  `pet` holds the state as of tick
+// boundary `syncedAt`; petSync() projects it to now.
+static uint32_t syncedAt = 0;
+
+void petProject(PetState& s, uint32_t ticks) {
+  petModelProject(s, ticks);
+}
+
+void petSync() {
+  uint32_t ticks = (millis() - syncedAt) / DECAY_INTERVAL;
+  if (ticks == 0) return;
+  petProject(pet, ticks);
+  syncedAt += ticks * DECAY_INTERVAL;
+}
+
+uint32_t petPhaseMs() {
+  return (millis() - syncedAt) % DECAY_INTERVAL;
+}
+
+void petResume(uint64_t elapsedMs) {
+  uint64_t ticks = elapsedMs / DECAY_INTERVAL;
+  petProject(pet, ticks > PET_SATURATE_TICKS ? PET_SATURATE_TICKS : (uint32_t)ticks);
+  syncedAt = millis() - (uint32_t)(elapsedMs % DECAY_INTERVAL);
+}
+
+// ── Decay tick: refresh + warnings ────────────────────────
 void petTickDecay() {
-  if (!pet.sleeping) {
-    pet.hunger = (uint8_t)max(0, (int)pet.hunger - 2);
-    pet.happy  = (uint8_t)max(0, (int)pet.happy  - 1);
-    pet.energy = (uint8_t)max(0, (int)pet.energy - 1);
-    if (pet.hunger < 20)
-      pet.hp = (uint8_t)max(0, (int)pet.hp - 1);
-  } else {
-    pet.energy = (uint8_t)min(100, (int)pet.energy + 5);
-    pet.hp     = (uint8_t)min(100, (int)pet.hp     + 2);
-  }
+  petSync();
 
-  // Trigger warnings
   if (pet.hunger < 15) {
     char msg[36];
     snprintf(msg, sizeof(msg), "%s IS HUNGRY!", creatureDNA.name);
@@ -33,11 +50,19 @@ void petTickDecay() {
   }
 }
 
+// ── Play rewards / costs ──────────────────────────────────
+void petAdjust(int happy, int energy) {
+  petSync();
+  pet.happy  = (uint8_t)constrain((int)pet.happy  + happy,  0, 100);
+  pet.energy = (uint8_t)constrain((int)pet.energy + energy, 0, 100);
+}
+
 // ── Feeding ───────────────────────────────────────────────
 void petFeed(int foodIndex) {
   if (foodIndex < 0 || foodIndex >= 6) return;
 
   uint8_t pts = foods[foodIndex].pts;
+  petSync();
   pet.hunger = (uint8_t)min(100, (int)pet.hunger + pts);
   pet.happy  = (uint8_t)min(100, (int)pet.happy  + pts / 5);
   pet.weight = (uint8_t)min(99,  (int)pet.weight + 1);
@@ -67,6 +92,7 @@ const char* petGetMoodString() {
 
 // ── Sleep ─────────────────────────────────────────────────
 void petSetSleeping(bool sleep) {
+  petSync();      // ticks so far used the old state
   pet.sleeping = sleep;
 }
 
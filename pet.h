@@ -8,9 +8,26 @@
 
 #include "types.h"
 
-// Stat decay / recovery (called on timer)
+// Stats are evaluated lazily in closed form: `pet` is exact as
+// of the last petSync(); call it before reading stats to draw.
+void        petSync();
+
+// Apply `ticks` decay ticks to `s` in O(1) (same result as
+// stepping the tick model)
+void        petProject(PetState& s, uint32_t ticks);
+
+// ms into the current decay period
+uint32_t    petPhaseMs();
+
+// After restoring `pet` from hibernation: it is `elapsedMs` old
+void        petResume(uint64_t elapsedMs);
+
+// Decay timer: sync + hungry / tired warnings
 void        petTickDecay();
 
+// Play rewards / costs (clamped 0–100)
+void        petAdjust(int happy, int energy);
+
 // Feeding
 void        petFeed(int foodIndex);
 
@@ -0,0 +1,57 @@
+/*
+ * pet_model.h — Closed-form pet stat model
+ * ──────────────────────────────────────────
+ * One decay tick every DECAY_INTERVAL:
+ *   awake:    hunger −2, happy −1, energy −1 (floor 0), and hp −1
+ *             (floor 0) on ticks that end with hunger < 20
+ *   sleeping: energy +5, hp +2 (cap 100)
+ * Each stat is a clamped linear function of the tick count; the
+ * only breakpoint is the tick where hunger first drops below 20,
+ * after which hp drains one per tick.
+ *
+ * Plain C++ (no Arduino headers) so the host test in tests/ can
+ * check it against the tick-by-tick model.  Works on any struct
+ * with uint8_t hp/hunger/happy/energy and bool sleeping.
+ */
+#pragma once
+
+#include <stdint.h>
+
+// Every stat has saturated after this many ticks (hunger hits 0
+// by tick 128, hp is drained 255 ticks later)
+#define PET_SATURATE_TICKS  1024
+
+namespace petmodel {
+
+inline uint8_t down(uint8_t v, uint32_t d) {
+  return (d >= v) ? 0 : (uint8_t)(v - d);
+}
+
+inline uint8_t up(uint8_t v, uint32_t d) {
+  return (v + d >= 100) ? 100 : (uint8_t)(v + d);
+}
+
+}  // namespace petmodel
+
+// Apply `ticks` decay ticks to s in O(1)
+template <class Stats>
+void petModelProject(Stats& s, uint32_t ticks) {
+  using namespace petmodel;
+  if (ticks == 0) return;
+  uint32_t n = (ticks < PET_SATURATE_TICKS) ? ticks : PET_SATURATE_TICKS;
+
+  if (s.sleeping) {
+    s.energy = up(s.energy, 5 * n);
+    s.hp     = up(s.hp,     2 * n);
+    return;
+  }
+
+  // First tick (1-based) that ends with hunger < 20
+  uint32_t firstLow = (s.hunger < 20) ? 1 : (s.hunger - 20) / 2 + 1;
+  uint32_t drained  = (n >= firstLow) ? n - firstLow + 1 : 0;
+
+  s.hunger = down(s.hunger, 2 * n);
+  s.happy  = down(s.happy,  n);
+  s.energy = down(s.energy, n);
+  s.hp     = down(s.hp,     drained);
+}
@@ -0,0 +1,187 @@
+/*
+ * power.cpp — Light sleep between scheduled events
+ * ──────────────────────────────────────────────────
+ */
+#include "power.h"
+#include "frame_gov.h"
+#include "bus_async.h"
+#include "fb_indexed.h"
+#include "input.h"
+#include "pet.h"
+#include "game_star.h"
+#include "game_rhythm.h"
+#include "game_balance.h"
+#include <esp_sleep.h>
+#include <esp_wake_stub.h>
+#include <driver/gpio.h>
+#include <soc/gpio_reg.h>
+#include <soc/io_mux_reg.h>
+#include <sys/time.h>
+
+#define HIBERNATE_MAGIC  0x45535048   // "ESPH"
+
+// Plain bytes only: anything with a constructor would be
+// re-initialised by the C++ runtime on every wake.
+struct HibernateState {
+  uint32_t magic;
+  uint8_t  pet[sizeof(PetState)];
+  uint8_t  view;
+  int32_t  starBest, rhythmBest, balanceBest;
+  uint64_t sleptAtMs;        // system time when hibernating
+  uint32_t sinceDecayMs;
+};
+
+RTC_DATA_ATTR static HibernateState rtcState;
+
+static uint64_t systemMs() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (uint64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+}
+
+void powerInit() {
+#if POWER_LIGHT_SLEEP
+  gpio_wakeup_enable((gpio_num_t)BTN_PIN, GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  // Keeps the backlight PWM clock (see profileInit) alive
+  esp_sleep_pd_config(ESP_PD_DOMAIN_RC_FAST, ESP_PD_OPTION_ON);
+#endif
+}
+
+bool powerWaitUntil(uint32_t wake) {
+  uint32_t now  = millis();
+  int32_t  wait = (int32_t)(wake - now);
+  if (wait <= 0) return false;
+
+#if POWER_LIGHT_SLEEP
+  if (wait >= LIGHT_SLEEP_MIN_MS && digitalRead(BTN_PIN) == HIGH) {
+    asyncBusFence();            // SPI DMA must not be cut off
+    esp_sleep_enable_timer_wakeup((uint64_t)wait * 1000);
+    esp_light_sleep_start();
+    govCountSleep(millis() - now);
+    return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO;
+  }
+#endif
+
+  delay(wait);
+  return false;
+}
+
+// ══════════════════════════════════════════════════════════
+//  HIBERNATION
+// ══════════════════════════════════════════════════════════
+
+static void deepSleep() {
+  esp_sleep_enable_timer_wakeup((uint64_t)HIBERNATE_POLL_MS * 1000);
+  esp_deep_sleep_start();
+}
+
+// ── Wake stub ─────────────────────────────────────────────
+// Runs from RTC memory straight out of the ROM on every deep-
+// sleep wake, before the bootloader: flash is not mapped, so
+// only RTC code/data and raw registers.  A released button
+// costs well under a millisecond awake instead of a full boot.
+#if POWER_HIBERNATE
+static_assert(BTN_PIN == 9, "wake stub samples IO_MUX_GPIO9_REG");
+
+void RTC_IRAM_ATTR esp_wake_deep_sleep(void) {
+  esp_default_wake_deep_sleep();
+  if (rtcState.magic != HIBERNATE_MAGIC) return;
+
+  // BOOT is active low; pads come up from reset, so enable
+  // the input and pull-up before sampling
+  SET_PERI_REG_MASK(IO_MUX_GPIO9_REG, FUN_IE | FUN_PU);
+  if (REG_READ(GPIO_IN_REG) & BIT(BTN_PIN)) {
+    esp_wake_stub_set_wakeup_time((uint64_t)HIBERNATE_POLL_MS * 1000);
+    esp_wake_stub_sleep(&esp_wake_deep_sleep);   // never returns
+  }
+  // Held: fall through to the bootloader and resume
+}
+#endif
+
+bool powerHibernateWake() {
+#if POWER_HIBERNATE
+  if (rtcState.magic != HIBERNATE_MAGIC) return false;
+  if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_TIMER) {
+    rtcState.magic = 0;       // other reset: start fresh
+    return false;
+  }
+  pinMode(BTN_PIN, INPUT_PULLUP);
+  delayMicroseconds(50);
+  if (digitalRead(BTN_PIN) == HIGH) deepSleep();   // released meanwhile
+
+  gpio_hold_dis((gpio_num_t)PIN_BL);
+  gpio_hold_dis((gpio_num_t)PIN_SENSOR_PWR);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void powerRestore() {
+  memcpy(&pet, rtcState.pet, sizeof(PetState));
+  starGame.bestScore      = rtcState.starBest;
+  rhythmGame.bestScore    = rtcState.rhythmBest;
+  balanceGame->bestScore  = rtcState.balanceBest;
+  currentView = previousView = (View)rtcState.view;
+
+  uint64_t elapsed = systemMs() - rtcState.sleptAtMs + rtcState.sinceDecayMs;
+  petResume(elapsed);
+  rtcState.magic = 0;
+
+  Serial.printf("[POWER] resumed after %lus\n", (unsigned long)(elapsed / 1000));
+}
+
+uint32_t powerHibernateDelay() {
+  uint32_t limit = (currentView == VIEW_SLEEP) ? HIBERNATE_SLEEP_MS
+                                               : HIBERNATE_IDLE_MS;
+  uint32_t idle  = millis() - inputLastActive();
+  return idle < limit ? limit - idle : limit;   // past it: game view
+}
+
+bool powerShouldHibernate() {
+#if POWER_HIBERNATE
+  uint32_t idle = millis() - inputLastActive();
+  if (!inputIdle()) return false;
+  if (currentView == VIEW_SLEEP) return idle >= HIBERNATE_SLEEP_MS;
+  if (currentView == VIEW_PLAY_RHYTHM || currentView == VIEW_PLAY_BALANCE)
+    return false;
+  return idle >= HIBERNATE_IDLE_MS;
+#else
+  return false;
+#endif
+}
+
+void powerHibernate() {
+  View resume = currentView;
+  if (resume == VIEW_PLAY || resume == VIEW_PLAY_RHYTHM ||
+      resume == VIEW_PLAY_BALANCE) {
+    resume = VIEW_MAIN;       // games do not survive a reboot
+  }
+
+  petSync();
+  rtcState.magic        = HIBERNATE_MAGIC;
+  memcpy(rtcState.pet, &pet, sizeof(PetState));
+  rtcState.view         = resume;
+  rtcState.starBest     = starGame.bestScore;
+  rtcState.rhythmBest   = rhythmGame.bestScore;
+  rtcState.balanceBest  = balanceGame->bestScore;
+  rtcState.sleptAtMs    = systemMs();
+  rtcState.sinceDecayMs = petPhaseMs();
+
+  Serial.println("[POWER] hibernating (hold BOOT to wake)");
+  Serial.flush();
+
+  // Panel off; hold the backlight and sensor rail pins low
+  // through deep sleep (released in powerHibernateWake)
+  asyncBusFence();
+  fbPanel()->displayOff();   // gfx may be the framebuffer
+  analogWrite(PIN_BL, 0);
+  pinMode(PIN_BL, OUTPUT);
+  digitalWrite(PIN_BL, LOW);
+  gpio_hold_en((gpio_num_t)PIN_BL);
+  digitalWrite(PIN_SENSOR_PWR, LOW);   // IMU rail off
+  gpio_hold_en((gpio_num_t)PIN_SENSOR_PWR);
+
+  deepSleep();
+}
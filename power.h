@@ -0,0 +1,65 @@
+/*
+ * power.h — Light sleep between scheduled events
+ * ────────────────────────────────────────────────
+ * powerWaitUntil() replaces the loop's delay(): when the next
+ * task is at least LIGHT_SLEEP_MIN_MS away the ESP32-C6 enters
+ * light sleep, woken by the timer or the BOOT button (BTN_PIN,
+ * low level).  RAM, peripherals and esp_timer survive, so
+ * millis() keeps counting through the sleep and OneButton's
+ * press timing is unaffected; a button wake is reported so the
+ * caller can poll input at once.
+ *
+ * Sleep is skipped (plain delay) while the button is held — it
+ * would wake the chip immediately — and while the panel DMA is
+ * still draining.  Residency is logged per view by frame_gov.
+ *
+ * Note: the USB-Serial/JTAG console drops while the chip sleeps;
+ * set POWER_LIGHT_SLEEP 0 in config.h for tethered debugging.
+ *
+ * Hibernation (POWER_HIBERNATE): after HIBERNATE_SLEEP_MS without
+ * input in the sleep view, or HIBERNATE_IDLE_MS in any non-game
+ * view, the panel is put to sleep and the chip enters deep sleep
+ * with pet stats, view and high scores in RTC memory.  BTN_PIN
+ * (GPIO9) is not an LP GPIO, so the C6 cannot wake from deep
+ * sleep on it: an RTC timer wakes the chip every
+ * HIBERNATE_POLL_MS and a deep-sleep wake stub (RTC memory,
+ * before the bootloader) samples the button and re-enters
+ * deep sleep unless it is held — no boot per poll.  The
+ * backlight and sensor-rail pins are held low while
+ * hibernating.  Holding the button
+ * resumes without the splash; the pet model is advanced by the
+ * elapsed time (system time is kept across deep sleep by the
+ * RTC).
+ */
+#pragma once
+
+#include "types.h"
+
+// Arm the button GPIO as a light-sleep wake source
+void powerInit();
+
+// Idle until `wake` (absolute millis).  Returns true if the
+// button ended the wait early.
+bool powerWaitUntil(uint32_t wake);
+
+// ── Hibernation ───────────────────────────────────────────
+// First thing in setup(): on a hibernation timer wake with the
+// button released since the wake stub ran, re-enters deep sleep
+// (never returns); otherwise releases the held pins.
+// Returns true if this boot resumes a hibernated pet.
+bool powerHibernateWake();
+
+// After game / pet init: restore RTC state and advance the pet
+// by the time spent hibernating
+void powerRestore();
+
+// Idle policy (sleep view / long inactivity)
+bool powerShouldHibernate();
+
+// ms until the idle policy could next trip — the hibernate
+// check is a one-shot task armed this far ahead (and re-armed
+// on input), not a periodic poll
+uint32_t powerHibernateDelay();
+
+// Save state, panel off, deep sleep (never returns)
+void powerHibernate();
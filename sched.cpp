@@ -0,0 +1,200 @@
+/*
+ * sched.cpp — Cooperative deadline scheduler
+ * ────────────────────────────────────────────
+ * Armed tasks are chained into the wheel bucket of their due
+ * tick.  A task's due tick is never behind the last visited
+ * tick (arming is always relative to now and periodic re-arms
+ * skip forward past now), so visiting buckets from the last
+ * visited tick up to now's tick finds every due task.
+ */
+#include "sched.h"
+
+struct Task {
+  const char* name;
+  TaskFn      fn;
+  uint32_t    period;      // 0 = one-shot
+  uint32_t    due;
+  uint32_t    deadline;    // allowed start lateness (ms)
+  TaskPrio    prio;
+  uint8_t     viewMask;
+  bool        armed;
+  int8_t      next;        // bucket chain
+  uint32_t    runs, misses, worstLate;
+};
+
+static Task     tasks[SCHED_MAX_TASKS];
+static uint8_t  taskCount  = 0;
+static int8_t   bucket[SCHED_SLOTS];
+static uint32_t lastTick   = 0;
+static bool     frameWanted = false;
+static uint32_t frameBy    = 0;
+static uint32_t lastReport = 0;
+
+static inline bool reached(uint32_t now, uint32_t t) {
+  return (int32_t)(now - t) >= 0;
+}
+
+static inline uint8_t slotOf(uint32_t due) {
+  return (due / SCHED_TICK_MS) % SCHED_SLOTS;
+}
+
+// ══════════════════════════════════════════════════════════
+//  WHEEL
+// ══════════════════════════════════════════════════════════
+
+static void link(int8_t id) {
+  Task& t = tasks[id];
+  uint8_t s = slotOf(t.due);
+  t.next    = bucket[s];
+  bucket[s] = id;
+  t.armed   = true;
+}
+
+static void unlink(int8_t id) {
+  Task& t = tasks[id];
+  if (!t.armed) return;
+  int8_t* p = &bucket[slotOf(t.due)];
+  while (*p >= 0 && *p != id) p = &tasks[*p].next;
+  if (*p == id) *p = t.next;
+  t.armed = false;
+}
+
+static int8_t addTask(const char* name, TaskFn fn, uint32_t period,
+                      TaskPrio prio, uint8_t viewMask, uint32_t deadline) {
+  if (taskCount == 0) {
+    for (int i = 0; i < SCHED_SLOTS; i++) bucket[i] = -1;
+    lastTick = millis() / SCHED_TICK_MS;
+  }
+  if (taskCount >= SCHED_MAX_TASKS) return -1;
+
+  int8_t id = taskCount++;
+  Task& t = tasks[id];
+  t = {};
+  t.name     = name;
+  t.fn       = fn;
+  t.period   = period;
+  t.prio     = prio;
+  t.viewMask = viewMask;
+  t.next     = -1;
+  t.deadline = deadline ? deadline : max((uint32_t)1, period / 4);
+  return id;
+}
+
+// ══════════════════════════════════════════════════════════
+//  TASKS
+// ══════════════════════════════════════════════════════════
+
+int8_t schedEvery(const char* name, TaskFn fn, uint32_t periodMs,
+                  TaskPrio prio, uint8_t viewMask, uint32_t deadlineMs) {
+  int8_t id = addTask(name, fn, periodMs, prio, viewMask, deadlineMs);
+  if (id >= 0) schedAfter(id, periodMs);
+  return id;
+}
+
+int8_t schedOnce(const char* name, TaskFn fn, TaskPrio prio,
+                 uint8_t viewMask, uint32_t deadlineMs) {
+  return addTask(name, fn, 0, prio, viewMask,
+                 deadlineMs ? deadlineMs : SCHED_TICK_MS);
+}
+
+void schedAfter(int8_t id, uint32_t delayMs) {
+  if (id < 0 || id >= taskCount) return;
+  unlink(id);
+  tasks[id].due = millis() + delayMs;
+  link(id);
+}
+
+void schedCancel(int8_t id) {
+  if (id >= 0 && id < taskCount) unlink(id);
+}
+
+void schedSetPeriod(int8_t id, uint32_t periodMs) {
+  if (id >= 0 && id < taskCount && tasks[id].period) tasks[id].period = periodMs;
+}
+
+void schedRequestFrame() {
+  uint32_t by = millis() + FRAME_TIME_MS;
+  if (!frameWanted || reached(frameBy, by)) frameBy = by;
+  frameWanted = true;
+}
+
+// ══════════════════════════════════════════════════════════
+//  DISPATCH
+// ══════════════════════════════════════════════════════════
+
+static void report(uint32_t now) {
+  if (now - lastReport < SCHED_REPORT_MS) return;
+  lastReport = now;
+  for (uint8_t i = 0; i < taskCount; i++) {
+    Task& t = tasks[i];
+    Serial.printf("[SCHED] %-7s runs %lu  miss %lu  worst %lums\n", t.name,
+                  (unsigned long)t.runs, (unsigned long)t.misses,
+                  (unsigned long)t.worstLate);
+  }
+}
+
+void schedRun(uint32_t now) {
+  // Collect due tasks from every bucket whose tick has passed
+  int8_t  ready[SCHED_MAX_TASKS];
+  uint8_t n = 0;
+  uint32_t nowTick = now / SCHED_TICK_MS;
+  uint32_t visits  = min(nowTick - lastTick + 1, (uint32_t)SCHED_SLOTS);
+  for (uint32_t k = 0; k < visits; k++) {
+    for (int8_t id = bucket[(lastTick + k) % SCHED_SLOTS]; id >= 0;
+         id = tasks[id].next) {
+      if (reached(now, tasks[id].due)) ready[n++] = id;
+    }
+  }
+  lastTick = nowTick;
+  if (frameWanted && reached(now, frameBy)) frameWanted = false;
+
+  // Priority order; registration order breaks ties
+  for (uint8_t i = 1; i < n; i++) {
+    int8_t id = ready[i];
+    int8_t j  = i;
+    while (j > 0 && (tasks[ready[j - 1]].prio > tasks[id].prio ||
+                     (tasks[ready[j - 1]].prio == tasks[id].prio &&
+                      ready[j - 1] > id))) {
+      ready[j] = ready[j - 1];
+      j--;
+    }
+    ready[j] = id;
+  }
+
+  for (uint8_t i = 0; i < n; i++) {
+    int8_t id = ready[i];
+    Task& t = tasks[id];
+    uint32_t due = t.due;
+    unlink(id);
+
+    if (t.viewMask & VIEW_BIT(currentView)) {
+      uint32_t late = millis() - due;
+      if (late > t.deadline) t.misses++;
+      if (late > t.worstLate) t.worstLate = late;
+      t.runs++;
+      t.fn();
+    }
+
+    // Periodic: keep the cadence; if a whole period was lost,
+    // restart from now rather than replaying the backlog
+    if (t.period && !t.armed) {
+      t.due = due + t.period;
+      uint32_t cur = millis();
+      if (reached(cur, t.due)) t.due = cur + t.period;
+      link(id);
+    }
+  }
+
+  report(now);
+}
+
+uint32_t schedNextWake(uint32_t now) {
+  uint32_t wake = now + SCHED_REPORT_MS;
+  for (uint8_t i = 0; i < taskCount; i++) {
+    const Task& t = tasks[i];
+    if (!t.armed || !(t.viewMask & VIEW_BIT(currentView))) continue;
+    if ((int32_t)(t.due - wake) < 0) wake = t.due;
+  }
+  if (frameWanted && (int32_t)(frameBy - wake) < 0) wake = frameBy;
+  return reached(now, wake) ? now : wake;
+}
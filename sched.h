@@ -0,0 +1,57 @@
+/*
+ * sched.h — Cooperative deadline scheduler
+ * ──────────────────────────────────────────
+ * Periodic and one-shot tasks kept on a hashed timer wheel
+ * (SCHED_SLOTS buckets of SCHED_TICK_MS).  schedRun() visits
+ * only the buckets whose tick has passed, runs the due tasks in
+ * priority order and re-arms periodic ones on their original
+ * cadence.  schedNextWake() gives the exact time the next task
+ * falls due, so loop() can sleep until then instead of spinning.
+ *
+ * Each task has a view mask: outside those views it keeps its
+ * cadence but neither runs nor wakes the loop.  A task that
+ * starts more than its deadline after it fell due counts as a
+ * miss; periodic tasks that fall a whole period behind skip the
+ * lost runs instead of bursting.  Stats are logged every
+ * SCHED_REPORT_MS as "[SCHED] ...".
+ */
+#pragma once
+
+#include "types.h"
+
+#define SCHED_MAX_TASKS  12
+#define SCHED_SLOTS      32
+#define SCHED_TICK_MS    8
+#define SCHED_REPORT_MS  30000
+
+#define VIEW_BIT(v)      ((uint8_t)(1u << (v)))
+#define VIEW_ALL         0xFF
+
+typedef void (*TaskFn)();
+
+enum TaskPrio : uint8_t { PRIO_HIGH, PRIO_NORMAL, PRIO_LOW };
+
+// Periodic task, first due one period from now.  deadlineMs = 0
+// → a quarter of the period.  Returns the task id (-1 if full).
+int8_t schedEvery(const char* name, TaskFn fn, uint32_t periodMs,
+                  TaskPrio prio, uint8_t viewMask = VIEW_ALL,
+                  uint32_t deadlineMs = 0);
+
+// One-shot task, idle until armed with schedAfter()
+int8_t schedOnce(const char* name, TaskFn fn, TaskPrio prio,
+                 uint8_t viewMask = VIEW_ALL, uint32_t deadlineMs = 0);
+
+// (Re)arm a task to fall due delayMs from now
+void schedAfter(int8_t id, uint32_t delayMs);
+void schedCancel(int8_t id);
+// Change a periodic task's cadence (takes effect on re-arm)
+void schedSetPeriod(int8_t id, uint32_t periodMs);
+
+// Run every task due at `now` (call once per loop pass)
+void schedRun(uint32_t now);
+
+// Wake again within one frame (an animation in progress)
+void schedRequestFrame();
+
+// Absolute millis() of the next due task for the current view
+uint32_t schedNextWake(uint32_t now);
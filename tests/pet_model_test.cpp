@@ -0,0 +1,101 @@
+/*
+ * pet_model_test.cpp — Closed-form stat model vs. tick model
+ * ────────────────────────────────────────────────────────────
+ * tickDecay() is the original per-tick petTickDecay() stat code
+ * (before pet_model.h).  petModelProject(s, n) must give exactly
+ * the state n calls of it give, for every start state and for
+ * split runs with sleep toggles in between.
+ */
+#include "../pet_model.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+struct Stats {
+  uint8_t hp, hunger, happy, energy;
+  bool    sleeping;
+};
+
+// Reference: the original decay tick
+static void tickDecay(Stats& pet) {
+  if (!pet.sleeping) {
+    pet.hunger = (uint8_t)std::max(0, (int)pet.hunger - 2);
+    pet.happy  = (uint8_t)std::max(0, (int)pet.happy  - 1);
+    pet.energy = (uint8_t)std::max(0, (int)pet.energy - 1);
+    if (pet.hunger < 20)
+      pet.hp = (uint8_t)std::max(0, (int)pet.hp - 1);
+  } else {
+    pet.energy = (uint8_t)std::min(100, (int)pet.energy + 5);
+    pet.hp     = (uint8_t)std::min(100, (int)pet.hp     + 2);
+  }
+}
+
+static bool same(const Stats& a, const Stats& b) {
+  return a.hp == b.hp && a.hunger == b.hunger &&
+         a.happy == b.happy && a.energy == b.energy;
+}
+
+static long checks = 0, failures = 0;
+
+static void expect(const Stats& start, const Stats& got, const Stats& want,
+                   uint32_t ticks) {
+  checks++;
+  if (same(got, want)) return;
+  if (failures++ < 10) {
+    printf("FAIL %s hp%u hunger%u happy%u energy%u after %u ticks: "
+           "got %u/%u/%u/%u want %u/%u/%u/%u\n",
+           start.sleeping ? "asleep" : "awake", start.hp, start.hunger,
+           start.happy, start.energy, ticks, got.hp, got.hunger, got.happy,
+           got.energy, want.hp, want.hunger, want.happy, want.energy);
+  }
+}
+
+// Every start state in range, 0…maxTicks ticks, plus a huge count
+static void exhaustive(uint32_t maxTicks) {
+  for (int sleeping = 0; sleeping < 2; sleeping++)
+  for (int hunger = 0; hunger <= 255; hunger += (hunger < 110 ? 1 : 29))
+  for (int hp = 0; hp <= 255; hp += (hp < 110 ? 1 : 29))
+  for (int energy = 0; energy <= 255; energy += (energy < 110 ? 7 : 29)) {
+    Stats start = { (uint8_t)hp, (uint8_t)hunger, (uint8_t)(255 - energy),
+                    (uint8_t)energy, sleeping != 0 };
+    Stats ref = start;
+    for (uint32_t n = 0; n <= maxTicks; n++) {
+      Stats got = start;
+      petModelProject(got, n);
+      expect(start, got, ref, n);
+      tickDecay(ref);
+    }
+    // Far past saturation the reference has stopped changing
+    Stats got = start;
+    petModelProject(got, 4000000000u);
+    expect(start, got, ref, 4000000000u);
+  }
+}
+
+// Random runs split into segments, toggling sleep in between
+static void segmented(int runs) {
+  std::mt19937 rng(1);
+  for (int r = 0; r < runs; r++) {
+    Stats a = { (uint8_t)(rng() % 101), (uint8_t)(rng() % 101),
+                (uint8_t)(rng() % 101), (uint8_t)(rng() % 101),
+                (rng() & 1) != 0 };
+    Stats start = a, b = a;
+    uint32_t total = 0;
+    for (int seg = 0; seg < 4; seg++) {
+      uint32_t n = rng() % 300;
+      petModelProject(a, n);
+      for (uint32_t i = 0; i < n; i++) tickDecay(b);
+      total += n;
+      if (rng() & 1) a.sleeping = b.sleeping = !a.sleeping;
+    }
+    expect(start, a, b, total);
+  }
+}
+
+int main() {
+  exhaustive(600);
+  segmented(200000);
+  printf("pet model: %ld checks, %ld failures\n", checks, failures);
+  return failures ? 1 : 0;
+}
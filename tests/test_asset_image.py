@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+"""
+test_asset_image.py — Unit tests for tools/asset_image.py
+──────────────────────────────────────────────────────────
+Round-trips images through build_image / verify_image, damages
+them (CRC, extents, header) and checks that manifest order sets
+both the TOC order and the generated PAK_* ids.
+
+    python3 -m unittest discover -s tests -p 'test_*.py'
+"""
+import os
+import random
+import struct
+import sys
+import tempfile
+import unittest
+import zlib
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                "..", "tools"))
+import asset_image as ai  # noqa: E402
+import asset_pack  # noqa: E402
+
+
+def sample_entries():
+    rng = random.Random(7)
+    px = [rng.choice([0x0000, 0xF800, 0x07E0, 0x1234]) for _ in range(13 * 5)]
+    return [
+        ("RAW", "raw", b"abc"),                                # unaligned size
+        ("BEATS", "u16", struct.pack("<3H", 1000, 800, 600)),
+        ("LEVELS", "i32", struct.pack("<2i", -1, 70000)),
+        ("SPRITE", "q565", asset_pack.encode(13, 5, px)),
+    ]
+
+
+def toc(img, i):
+    return ai.ENTRY.unpack_from(img, ai.HEADER.size + i * ai.ENTRY.size)
+
+
+def reseal(img):
+    """Recompute the header CRC after a deliberate edit."""
+    img = bytearray(img)
+    size = ai.HEADER.unpack_from(img)[3]
+    struct.pack_into("<I", img, 12, zlib.crc32(bytes(img[ai.HEADER.size:size])))
+    return bytes(img)
+
+
+class RoundTrip(unittest.TestCase):
+    def test_entries_come_back_in_place(self):
+        entries = sample_entries()
+        img = ai.build_image(entries)
+        listed = ai.verify_image(img)
+        self.assertEqual(listed, [(ai.KINDS[k], len(d)) for _, k, d in entries])
+        for i, (_, kind, data) in enumerate(entries):
+            off, n, k, reserved = toc(img, i)
+            self.assertEqual(off % 4, 0)
+            self.assertEqual((n, k, reserved), (len(data), ai.KINDS[kind], 0))
+            self.assertEqual(img[off:off + n], data)
+
+    def test_header(self):
+        img = ai.build_image(sample_entries())
+        magic, version, count, size, crc = ai.HEADER.unpack_from(img)
+        self.assertEqual((magic, version, count), (ai.MAGIC, ai.VERSION, 4))
+        self.assertEqual(size, len(img))
+        self.assertEqual(crc, zlib.crc32(img[ai.HEADER.size:]))
+
+    def test_q565_entry_decodes(self):
+        entries = sample_entries()
+        img = ai.build_image(entries)
+        off, n, _, _ = toc(img, 3)
+        w, h, px = asset_pack.decode(img[off:off + n])
+        self.assertEqual((w, h), (13, 5))
+        self.assertEqual(asset_pack.encode(w, h, px), entries[3][2])
+
+    def test_empty_image(self):
+        self.assertEqual(ai.verify_image(ai.build_image([])), [])
+
+
+class Damage(unittest.TestCase):
+    def setUp(self):
+        self.img = ai.build_image(sample_entries())
+
+    def assertRejected(self, img, msg):
+        with self.assertRaisesRegex(ValueError, msg):
+            ai.verify_image(img)
+
+    def test_crc_catches_body_flip(self):
+        img = bytearray(self.img)
+        img[-1] ^= 0x01
+        self.assertRejected(bytes(img), "CRC")
+
+    def test_crc_catches_toc_flip(self):
+        img = bytearray(self.img)
+        img[ai.HEADER.size] ^= 0x80
+        self.assertRejected(bytes(img), "CRC")
+
+    def test_extent_past_end(self):
+        img = bytearray(self.img)
+        off, n, kind, _ = toc(img, 0)
+        ai.ENTRY.pack_into(img, ai.HEADER.size, off, len(img), kind, 0)
+        self.assertRejected(reseal(img), "bad extent")
+
+    def test_misaligned_offset(self):
+        img = bytearray(self.img)
+        off, n, kind, _ = toc(img, 1)
+        ai.ENTRY.pack_into(img, ai.HEADER.size + ai.ENTRY.size, off + 1, n, kind, 0)
+        self.assertRejected(reseal(img), "bad extent")
+
+    def test_bad_magic(self):
+        self.assertRejected(b"XPAK" + self.img[4:], "magic")
+
+    def test_bad_version(self):
+        img = bytearray(self.img)
+        struct.pack_into("<H", img, 4, ai.VERSION + 1)
+        self.assertRejected(bytes(img), "version")
+
+    def test_truncated(self):
+        self.assertRejected(self.img[:8], "truncated")
+        self.assertRejected(self.img[:-4], "exceeds")
+
+    def test_oversize_partition(self):
+        img = ai.build_image([("BIG", "raw", bytes(ai.PARTITION_SIZE))])
+        self.assertRejected(img, "partition")
+
+
+class Manifest(unittest.TestCase):
+    def setUp(self):
+        self.dir = tempfile.TemporaryDirectory()
+        d = self.dir.name
+        with open(os.path.join(d, "beats.txt"), "w") as f:
+            f.write("1000 800  # easy, medium\n0x258\n")
+        with open(os.path.join(d, "blob.bin"), "wb") as f:
+            f.write(b"\x01\x02\x03\x04\x05")
+
+    def tearDown(self):
+        self.dir.cleanup()
+
+    def manifest(self, text):
+        path = os.path.join(self.dir.name, "pak.txt")
+        with open(path, "w") as f:
+            f.write(text)
+        return path
+
+    def test_order_sets_toc_and_ids(self):
+        path = self.manifest("# comment\nZETA raw blob.bin\n\nALPHA u16 beats.txt\n")
+        entries = ai.read_manifest(path)
+        self.assertEqual([e[0] for e in entries], ["ZETA", "ALPHA"])
+        self.assertEqual(entries[1][2], struct.pack("<3H", 1000, 800, 600))
+
+        img = ai.build_image(entries)
+        self.assertEqual(ai.verify_image(img),
+                         [(ai.KINDS["raw"], 5), (ai.KINDS["u16"], 6)])
+
+        ids = os.path.join(self.dir.name, "asset_ids.h")
+        ai.write_ids(ids, entries)
+        with open(ids, encoding="utf-8") as f:
+            text = f.read()
+        self.assertLess(text.index("PAK_ZETA,"), text.index("PAK_ALPHA,"))
+        self.assertLess(text.index("PAK_ALPHA,"), text.index("PAK_COUNT"))
+        self.assertIn(f"#define PAK_VERSION      {ai.VERSION}", text)
+
+    def test_duplicate_id_rejected(self):
+        path = self.manifest("A raw blob.bin\nA raw blob.bin\n")
+        with self.assertRaises(SystemExit):
+            ai.read_manifest(path)
+
+    def test_unknown_kind_rejected(self):
+        path = self.manifest("A png blob.bin\n")
+        with self.assertRaises(SystemExit):
+            ai.read_manifest(path)
+
+    def test_checked_in_ids_match_manifest(self):
+        root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+        entries = ai.read_manifest(os.path.join(root, "assets", "pak.txt"))
+        ids = os.path.join(self.dir.name, "asset_ids.h")
+        ai.write_ids(ids, entries)
+        with open(ids, encoding="utf-8") as f, \
+             open(os.path.join(root, "asset_ids.h"), encoding="utf-8") as g:
+            self.assertEqual(f.read(), g.read())
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""
+asset_image.py — Build / verify the read-only asset partition
+──────────────────────────────────────────────────────────────
+Packs the assets listed in a manifest (assets/pak.txt) into one
+flash image for the `assets` partition in partitions.csv, and
+writes asset_ids.h with one PAK_* id per entry.  The sketch maps
+the partition with esp_partition_mmap and reads assets in place
+(asset_pak.h); ids index the table of contents directly.
+
+    python3 tools/asset_image.py build assets/pak.txt \\
+            -o build/assets.pak --ids asset_ids.h
+    python3 tools/asset_image.py verify build/assets.pak
+    esptool.py write_flash 0x3D0000 build/assets.pak
+
+Image layout (little-endian):
+    0   'EPAK'    magic
+    4   u16       format version (PAK_VERSION)
+    6   u16       entry count
+    8   u32       image size in bytes
+    12  u32       CRC-32 of bytes [16, size)
+    16  entry[count] × 12 bytes:
+            u32 offset   from the start of the image
+            u32 size     in bytes
+            u16 kind     PAK_KIND_*
+            u16 reserved 0
+    …   entry data, each starting on a 4-byte boundary
+
+Runs on any host with Python 3 and only the standard library.
+Unit tests: tests/test_asset_image.py.
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import asset_pack  # noqa: E402  (Q565 encoder / decoder)
+
+MAGIC = b"EPAK"
+VERSION = 1
+HEADER = struct.Struct("<4sHHII")
+ENTRY = struct.Struct("<IIHH")
+KINDS = {"raw": 0, "q565": 1, "u16": 2, "i32": 3}
+PARTITION_SIZE = 0x20000   # keep in step with partitions.csv
+
+
+# ── Manifest ────────────────────────────────────────────────
+def read_numbers(path):
+    nums = []
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            nums += [int(tok, 0) for tok in line.split("#")[0].split()]
+    return nums
+
+
+def load_entry(kind, path):
+    if kind == "q565":
+        return asset_pack.encode(*asset_pack.read_png(path))
+    if kind == "u16":
+        return struct.pack(f"<{len(read_numbers(path))}H", *read_numbers(path))
+    if kind == "i32":
+        return struct.pack(f"<{len(read_numbers(path))}i", *read_numbers(path))
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def read_manifest(path):
+    base = os.path.dirname(path)
+    entries = []
+    with open(path, encoding="utf-8") as f:
+        for n, line in enumerate(f, 1):
+            fields = line.split("#")[0].split()
+            if not fields:
+                continue
+            if len(fields) != 3 or fields[1] not in KINDS:
+                sys.exit(f"{path}:{n}: expected <ID> <{'|'.join(KINDS)}> <source>")
+            ident, kind, src = fields
+            if any(e[0] == ident for e in entries):
+                sys.exit(f"{path}:{n}: duplicate id {ident}")
+            entries.append((ident, kind, load_entry(kind, os.path.join(base, src))))
+    return entries
+
+
+# ── Image ───────────────────────────────────────────────────
+def build_image(entries):
+    toc_end = HEADER.size + ENTRY.size * len(entries)
+    body, toc = bytearray(), bytearray()
+    offset = (toc_end + 3) & ~3
+    for _, kind, data in entries:
+        toc += ENTRY.pack(offset, len(data), KINDS[kind], 0)
+        body += data + b"\0" * (-len(data) & 3)
+        offset += len(data) + (-len(data) & 3)
+
+    tail = bytes(toc) + b"\0" * (-toc_end & 3) + bytes(body)
+    size = HEADER.size + len(tail)
+    return HEADER.pack(MAGIC, VERSION, len(entries), size,
+                       zlib.crc32(tail)) + tail
+
+
+def verify_image(img):
+    """Return a list of (kind, size) per entry; raise ValueError on damage."""
+    if len(img) < HEADER.size:
+        raise ValueError("truncated header")
+    magic, version, count, size, crc = HEADER.unpack_from(img)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError(f"bad magic/version {magic!r} v{version}")
+    if size > len(img) or size > PARTITION_SIZE:
+        raise ValueError(f"size {size} exceeds image/partition")
+    if zlib.crc32(img[HEADER.size:size]) != crc:
+        raise ValueError("CRC mismatch")
+
+    out = []
+    for i in range(count):
+        off, n, kind, _ = ENTRY.unpack_from(img, HEADER.size + i * ENTRY.size)
+        if off & 3 or off + n > size:
+            raise ValueError(f"entry {i}: bad extent {off}+{n}")
+        if kind == KINDS["q565"]:
+            w, h, px = asset_pack.decode(img[off:off + n])
+            if len(px) != w * h:
+                raise ValueError(f"entry {i}: short Q565 stream")
+        out.append((kind, n))
+    return out
+
+
+def write_ids(path, entries):
+    name = os.path.basename(path)
+    lines = [
+        "/*",
+        f" * {name} — Asset partition ids",
+        " * " + "─" * (len(name) + 24),
+        " * Generated by tools/asset_image.py from assets/pak.txt —",
+        " * do not edit.  Ids index the partition's table of contents.",
+        " */",
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+        f"#define PAK_VERSION      {VERSION}",
+        "",
+    ]
+    for kind, val in KINDS.items():
+        lines.append(f"#define PAK_KIND_{kind.upper():<6} {val}")
+    lines += ["", "enum PakId : uint16_t {"]
+    for i, (ident, kind, data) in enumerate(entries):
+        lines.append(f"  PAK_{ident + ',':<16} // {kind:<4} {len(data)} bytes")
+    lines += ["  PAK_COUNT", "};"]
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+# ── CLI ─────────────────────────────────────────────────────
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    b = sub.add_parser("build", help="pack a manifest into an image")
+    b.add_argument("manifest")
+    b.add_argument("-o", "--output", required=True)
+    b.add_argument("--ids", help="also write the PAK_* id header")
+    v = sub.add_parser("verify", help="check an image's header, TOC and CRC")
+    v.add_argument("image")
+    args = ap.parse_args()
+
+    if args.cmd == "build":
+        entries = read_manifest(args.manifest)
+        img = build_image(entries)
+        verify_image(img)
+        os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+        with open(args.output, "wb") as f:
+            f.write(img)
+        if args.ids:
+            write_ids(args.ids, entries)
+        print(f"{args.output}: {len(entries)} assets, {len(img)} bytes "
+              f"({100 * len(img) // PARTITION_SIZE}% of partition)")
+    else:
+        with open(args.image, "rb") as f:
+            img = f.read()
+        try:
+            for i, (kind, n) in enumerate(verify_image(img)):
+                print(f"  {i:3d}  kind {kind}  {n} bytes")
+        except ValueError as e:
+            sys.exit(f"{args.image}: {e}")
+        print(f"{args.image}: OK")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""
+asset_pack.py — PNG → Q565 compressed asset header
+───────────────────────────────────────────────────
+Encodes RGB565 images in the Q565 format decoded on-device by
+ui_asset.cpp and writes them as PROGMEM arrays into one header.
+
+    python3 tools/asset_pack.py -o assets.h assets/ground.png ...
+
+Each array is named ASSET_<FILE STEM>.  Images are decoded back
+and compared before anything is written, so a codec mismatch
+fails here rather than on the panel.
+
+Q565 stream (after a 6-byte header 'Q' '5' w16le h16le):
+    00iiiiii            INDEX    colour from the 64-entry table
+    01nnnnnn            RUN      previous pixel × (n + 1), 1..64
+    10rrggbb            DIFF     r,g,b += (field − 2), wrapping
+    110nnnnn nnnnnnnn   LONGRUN  previous pixel × (n + 65)
+    11111110 hi lo      LITERAL  RGB565, big-endian
+Every INDEX / DIFF / LITERAL pixel is stored in the table at
+hash(c) = (r*3 + g*5 + b*7) & 63.  The previous pixel starts at
+0x0000; runs may cross rows.
+
+Only the standard library is used: PNGs must be 8-bit RGB or
+RGBA (alpha ignored), non-interlaced.
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+RUN_MAX = 64
+LONGRUN_MAX = 65 + 0x1FFF
+
+
+# ── PNG reader ──────────────────────────────────────────────
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit(f"{path}: not a PNG")
+
+    pos, idat, hdr = 8, b"", None
+    while pos < len(data):
+        n, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + n]
+        if kind == b"IHDR":
+            hdr = struct.unpack(">IIBBBBB", body)
+        elif kind == b"IDAT":
+            idat += body
+        pos += 12 + n
+
+    w, h, depth, ctype, _, _, interlace = hdr
+    if depth != 8 or ctype not in (2, 6) or interlace:
+        sys.exit(f"{path}: need 8-bit RGB/RGBA, non-interlaced")
+    bpp = 3 if ctype == 2 else 4
+    raw = zlib.decompress(idat)
+
+    stride = w * bpp
+    rows, prev = [], bytearray(stride)
+    for y in range(h):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pr = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pr) & 0xFF
+        rows.append(line)
+        prev = line
+
+    pixels = []
+    for line in rows:
+        for x in range(w):
+            r, g, b = line[x * bpp:x * bpp + 3]
+            pixels.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return w, h, pixels
+
+
+# ── Q565 codec ──────────────────────────────────────────────
+def split(c):
+    return c >> 11, (c >> 5) & 0x3F, c & 0x1F
+
+
+def qhash(c):
+    r, g, b = split(c)
+    return (r * 3 + g * 5 + b * 7) & 63
+
+
+def encode(w, h, pixels):
+    out = bytearray(b"Q5" + struct.pack("<HH", w, h))
+    table = [0] * 64
+    prev, run = 0, 0
+
+    def flush_run():
+        nonlocal run
+        while run:
+            n = min(run, LONGRUN_MAX)
+            if n <= RUN_MAX:
+                out.append(0x40 | (n - 1))
+            else:
+                out.extend((0xC0 | ((n - 65) >> 8), (n - 65) & 0xFF))
+            run -= n
+
+    for c in pixels:
+        if c == prev:
+            run += 1
+            continue
+        flush_run()
+
+        h_ = qhash(c)
+        pr, pg, pb = split(prev)
+        r, g, b = split(c)
+        dr = ((r - pr + 16) & 31) - 16
+        dg = ((g - pg + 32) & 63) - 32
+        db = ((b - pb + 16) & 31) - 16
+        if table[h_] == c:
+            out.append(h_)
+        elif -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+            out.append(0x80 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+        else:
+            out += bytes((0xFE, c >> 8, c & 0xFF))
+        table[h_] = c
+        prev = c
+    flush_run()
+    return bytes(out)
+
+
+def decode(data):
+    w, h = struct.unpack("<HH", data[2:6])
+    table = [0] * 64
+    prev, pos, pixels = 0, 6, []
+    while len(pixels) < w * h:
+        op = data[pos]
+        pos += 1
+        if op < 0x40:
+            c = table[op]
+        elif op < 0x80:
+            pixels += [prev] * ((op & 0x3F) + 1)
+            continue
+        elif op < 0xC0:
+            r, g, b = split(prev)
+            r = (r + ((op >> 4) & 3) - 2) & 31
+            g = (g + ((op >> 2) & 3) - 2) & 63
+            b = (b + (op & 3) - 2) & 31
+            c = (r << 11) | (g << 5) | b
+        elif op < 0xE0:
+            pixels += [prev] * ((((op & 0x1F) << 8) | data[pos]) + 65)
+            pos += 1
+            continue
+        elif op == 0xFE:
+            c = (data[pos] << 8) | data[pos + 1]
+            pos += 2
+        else:
+            raise ValueError(f"reserved op 0x{op:02X}")
+        table[qhash(c)] = c
+        pixels.append(c)
+        prev = c
+    return w, h, pixels[:w * h]
+
+
+# ── Header writer ───────────────────────────────────────────
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("-o", "--output", required=True, help="header to write")
+    ap.add_argument("images", nargs="+", help="PNG files")
+    args = ap.parse_args()
+
+    lines = [
+        "/*",
+        f" * {os.path.basename(args.output)} — Compressed image assets (Q565)",
+        " * " + "─" * (len(os.path.basename(args.output)) + 35),
+        " * Generated by tools/asset_pack.py — do not edit; draw",
+        " * with assetDraw() from ui_asset.h.",
+        " */",
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+    ]
+    for path in args.images:
+        w, h, pixels = read_png(path)
+        q = encode(w, h, pixels)
+        if decode(q) != (w, h, pixels):
+            sys.exit(f"{path}: round-trip mismatch")
+
+        stem = os.path.splitext(os.path.basename(path))[0]
+        name = "ASSET_" + "".join(ch if ch.isalnum() else "_" for ch in stem).upper()
+        lines += [
+            "",
+            f"// {os.path.basename(path)}  {w}×{h}  "
+            f"{w * h * 2} → {len(q)} bytes",
+            f"static const uint8_t {name}[] PROGMEM = {{",
+        ]
+        for i in range(0, len(q), 12):
+            lines.append("  " + ", ".join(f"0x{b:02X}" for b in q[i:i + 12]) + ",")
+        lines.append("};")
+        print(f"{path}: {w}x{h}, {w * h * 2} -> {len(q)} bytes")
+
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
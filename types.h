@@ -112,10 +112,6 @@ extern BalanceGameState* balanceGame;  // Pointer since struct is forward-declar
 extern int      animFrame;
 extern bool     viewDirty;
 
-// Timing
-extern uint32_t lastAnimTick;
-extern uint32_t lastDecayTick;
-
 // Input (shared so nav.cpp can read cursor)
 extern int      actionCursor;   // main view: 0-3
 extern int      selectedFood;   // feed view: 0-6
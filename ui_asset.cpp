@@ -0,0 +1,79 @@
+/*
+ * ui_asset.cpp — Streaming decoder for compressed image assets
+ * ──────────────────────────────────────────────────────────────
+ * Mirrors decode() in tools/asset_pack.py.  Runs may span band
+ * and row boundaries, so the pending run count is carried
+ * across bands.  The two band buffers alternate so an
+ * asynchronous bus can send one while the next is decoded.
+ */
+#include "ui_asset.h"
+
+#define Q565_HEADER   6
+
+static DMA_ATTR uint16_t bandBuf[2][ASSET_BAND_PX];
+static uint8_t  bandCur = 0;
+
+static inline uint8_t qHash(uint16_t c) {
+  return ((c >> 11) * 3 + ((c >> 5) & 0x3F) * 5 + (c & 0x1F) * 7) & 63;
+}
+
+bool assetSize(const uint8_t* a, uint16_t& w, uint16_t& h) {
+  if (pgm_read_byte(a) != 'Q' || pgm_read_byte(a + 1) != '5') return false;
+  w = pgm_read_byte(a + 2) | (pgm_read_byte(a + 3) << 8);
+  h = pgm_read_byte(a + 4) | (pgm_read_byte(a + 5) << 8);
+  return true;
+}
+
+void assetDraw(const uint8_t* a, int x, int y) {
+  uint16_t w, h;
+  if (!assetSize(a, w, h) || w == 0 || w > ASSET_BAND_PX) return;
+
+  const uint8_t* p = a + Q565_HEADER;
+  uint16_t table[64] = {0};
+  uint16_t prev = 0;
+  uint32_t run  = 0;            // pixels of prev still owed
+  int bandRows  = ASSET_BAND_PX / w;
+
+  for (int y0 = 0; y0 < h; y0 += bandRows) {
+    int rows = min(bandRows, h - y0);
+    uint16_t* out = bandBuf[bandCur];
+    uint16_t* end = out + rows * w;
+
+    while (out < end) {
+      if (run) {
+        uint32_t n = min(run, (uint32_t)(end - out));
+        for (uint32_t i = 0; i < n; i++) *out++ = prev;
+        run -= n;
+        continue;
+      }
+
+      uint8_t op = pgm_read_byte(p++);
+      uint16_t c;
+      if (op < 0x40) {                       // INDEX
+        c = table[op];
+      } else if (op < 0x80) {                // RUN 1..64
+        run = (op & 0x3F) + 1;
+        continue;
+      } else if (op < 0xC0) {                // DIFF
+        uint8_t r = ((prev >> 11)         + ((op >> 4) & 3) - 2) & 0x1F;
+        uint8_t g = (((prev >> 5) & 0x3F) + ((op >> 2) & 3) - 2) & 0x3F;
+        uint8_t b = ((prev & 0x1F)        + (op & 3)        - 2) & 0x1F;
+        c = (r << 11) | (g << 5) | b;
+      } else if (op < 0xE0) {                // LONGRUN 65..8256
+        run = (((op & 0x1F) << 8) | pgm_read_byte(p++)) + 65;
+        continue;
+      } else if (op == 0xFE) {               // LITERAL
+        c = (pgm_read_byte(p) << 8) | pgm_read_byte(p + 1);
+        p += 2;
+      } else {
+        Serial.printf("[ASSET] Bad op 0x%02X\n", op);
+        return;
+      }
+      table[qHash(c)] = c;
+      *out++ = prev = c;
+    }
+
+    gfx->draw16bitRGBBitmap(x, y + y0, bandBuf[bandCur], w, rows);
+    bandCur ^= 1;
+  }
+}
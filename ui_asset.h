@@ -0,0 +1,27 @@
+/*
+ * ui_asset.h — Streaming decoder for compressed image assets
+ * ────────────────────────────────────────────────────────────
+ * Artwork is packed on the host by tools/asset_pack.py into
+ * Q565 streams (QOI-style index / run / diff / literal ops on
+ * RGB565, see the tool for the byte format) read in place from
+ * the asset partition (asset_pak.h) or from PROGMEM arrays the
+ * tool writes into a header.
+ *
+ * assetDraw() decodes straight into a band of line buffer and
+ * pushes each band as one window through `gfx` — the image is
+ * never expanded in RAM, so a background costs flash bytes,
+ * not frame time spent in many small draw calls.  Assets are
+ * opaque rectangles; the decoder keeps only its 64-entry
+ * colour table and the previous pixel.
+ */
+#pragma once
+
+#include "types.h"
+
+#define ASSET_BAND_PX  (SCREEN_W * 4)   // per push buffer (px)
+
+// Size from an asset's header; false if it isn't a Q565 stream
+bool assetSize(const uint8_t* asset, uint16_t& w, uint16_t& h);
+
+// Decode and push the whole image with its top-left at (x, y)
+void assetDraw(const uint8_t* asset, int x, int y);
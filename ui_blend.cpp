@@ -0,0 +1,52 @@
+/*
+ * ui_blend.cpp — RGB565 blending kernels (SWAR)
+ * ───────────────────────────────────────────────
+ * Each kernel peels an unaligned leading pixel, runs the paired
+ * loop over whole words and finishes an odd trailing pixel.
+ * Buffers whose alignments differ take the scalar path.
+ */
+#include "ui_blend.h"
+
+static inline bool aligned4(const void* p) {
+  return ((uintptr_t)p & 3) == 0;
+}
+
+void blendBuf(uint16_t* dst, const uint16_t* src, int n, uint8_t alpha) {
+  if (alpha == 0 || n <= 0) return;
+  if (aligned4(dst) != aligned4(src)) {
+    for (int i = 0; i < n; i++) dst[i] = blendPixel(dst[i], src[i], alpha);
+    return;
+  }
+  if (!aligned4(dst)) { *dst = blendPixel(*dst, *src++, alpha); dst++; n--; }
+
+  uint32_t*       d = (uint32_t*)dst;
+  const uint32_t* s = (const uint32_t*)src;
+  for (int i = 0; i < (n >> 1); i++) d[i] = blendPair(d[i], s[i], alpha);
+  if (n & 1) dst[n - 1] = blendPixel(dst[n - 1], src[n - 1], alpha);
+}
+
+void blendFill(uint16_t* dst, int n, uint16_t color, uint8_t alpha) {
+  if (alpha == 0 || n <= 0) return;
+  if (!aligned4(dst)) { *dst = blendPixel(*dst, color, alpha); dst++; n--; }
+
+  uint32_t  c2 = color | ((uint32_t)color << 16);
+  uint32_t* d  = (uint32_t*)dst;
+  for (int i = 0; i < (n >> 1); i++) d[i] = blendPair(d[i], c2, alpha);
+  if (n & 1) dst[n - 1] = blendPixel(dst[n - 1], color, alpha);
+}
+
+void blendCross(uint16_t* dst, const uint16_t* a, const uint16_t* b, int n,
+                uint8_t alpha) {
+  if (n <= 0) return;
+  if (aligned4(dst) != aligned4(a) || aligned4(dst) != aligned4(b)) {
+    for (int i = 0; i < n; i++) dst[i] = blendPixel(a[i], b[i], alpha);
+    return;
+  }
+  if (!aligned4(dst)) { *dst++ = blendPixel(*a++, *b++, alpha); n--; }
+
+  uint32_t*       d  = (uint32_t*)dst;
+  const uint32_t* pa = (const uint32_t*)a;
+  const uint32_t* pb = (const uint32_t*)b;
+  for (int i = 0; i < (n >> 1); i++) d[i] = blendPair(pa[i], pb[i], alpha);
+  if (n & 1) dst[n - 1] = blendPixel(a[n - 1], b[n - 1], alpha);
+}
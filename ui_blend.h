@@ -0,0 +1,47 @@
+/*
+ * ui_blend.h — RGB565 blending kernels (SWAR)
+ * ─────────────────────────────────────────────
+ * Constant-alpha blend, fade-to-colour and cross-fade over
+ * line or tile buffers.  Two RGB565 pixels are processed per
+ * 32-bit word: the word is split into two lanes whose colour
+ * fields sit ≥ 5 bits apart, so one multiply by a 0–32 weight
+ * scales three fields at once without carries crossing over.
+ *
+ *   lane A = w & 0x07E0F81F          (B0, R0, G1)
+ *   lane B = (w >> 5) & 0x07C0F83F   (G0, B1, R1)
+ *
+ * Alpha is 0..BLEND_MAX (32 = all of the second operand).
+ * Buffers should be 4-byte aligned for the paired path; an odd
+ * leading or trailing pixel goes through the scalar kernel.
+ */
+#pragma once
+
+#include "types.h"
+
+#define BLEND_MAX  32
+
+// Two packed pixels: a·(32−alpha)/32 + b·alpha/32, per field
+static inline uint32_t blendPair(uint32_t a, uint32_t b, uint8_t alpha) {
+  const uint32_t MASK_A = 0x07E0F81F;
+  const uint32_t MASK_B = 0x07C0F83F;
+  uint32_t ia = BLEND_MAX - alpha;
+  uint32_t lo = (((a & MASK_A) * ia + (b & MASK_A) * alpha) >> 5) & MASK_A;
+  uint32_t hi = (((a >> 5) & MASK_B) * ia + ((b >> 5) & MASK_B) * alpha)
+                & (MASK_B << 5);
+  return lo | hi;
+}
+
+// One pixel (same rounding as blendPair)
+static inline uint16_t blendPixel(uint16_t a, uint16_t b, uint8_t alpha) {
+  return (uint16_t)blendPair(a, b, alpha);
+}
+
+// dst = dst blended toward src by alpha
+void blendBuf(uint16_t* dst, const uint16_t* src, int n, uint8_t alpha);
+
+// dst = dst faded toward colour by alpha (translucent overlays, dimming)
+void blendFill(uint16_t* dst, int n, uint16_t color, uint8_t alpha);
+
+// dst = a cross-faded into b by alpha (dst may alias a or b)
+void blendCross(uint16_t* dst, const uint16_t* a, const uint16_t* b, int n,
+                uint8_t alpha);
@@ -6,6 +6,9 @@
 #include "creature_gen.h"
 #include "nav.h"      // navViewBgColor
 #include "pet.h"      // petGetMood
+#include "ui_sprite.h" // petSpriteDraw
+#include "ui_damage.h" // damageCapture
+#include "ui_blend.h"
 
 // ══════════════════════════════════════════════════════════
 //  NOTIFICATION
@@ -19,9 +22,32 @@ void triggerNotif(const char* msg) {
   notif.endTime  = millis() + NOTIF_DURATION;
 }
 
+// Box geometry; the view shows through at NOTIF_ALPHA/32 black
+#define NOTIF_X      6
+#define NOTIF_Y      28
+#define NOTIF_W      228
+#define NOTIF_H      22
+#define NOTIF_ALPHA  26
+
 void drawNotification() {
-  gfx->fillRoundRect(6, 28, 228, 22, 4, COL_BLACK);
-  gfx->drawRoundRect(6, 28, 228, 22, 4, COL_YELLOW);
+  // Translucent: render what the box covers, darken it inside the
+  // rounded outline and push it back as one window
+  uint16_t* under = (uint16_t*)malloc(NOTIF_W * NOTIF_H * sizeof(uint16_t));
+  if (under) {
+    static const uint8_t corner[4] = { 4, 2, 1, 1 };
+    damageCapture(NOTIF_X, NOTIF_Y, NOTIF_W, NOTIF_H, under);
+    for (int row = 0; row < NOTIF_H; row++) {
+      int in = (row < 4) ? corner[row]
+             : (row >= NOTIF_H - 4) ? corner[NOTIF_H - 1 - row] : 0;
+      blendFill(under + row * NOTIF_W + in, NOTIF_W - 2 * in,
+                COL_BLACK, NOTIF_ALPHA);
+    }
+    gfx->draw16bitRGBBitmap(NOTIF_X, NOTIF_Y, under, NOTIF_W, NOTIF_H);
+    free(under);
+  } else {
+    gfx->fillRoundRect(NOTIF_X, NOTIF_Y, NOTIF_W, NOTIF_H, 4, COL_BLACK);
+  }
+  gfx->drawRoundRect(NOTIF_X, NOTIF_Y, NOTIF_W, NOTIF_H, 4, COL_YELLOW);
   gfx->setTextColor(COL_YELLOW);
   gfx->setTextSize(1);
   int tw = strlen(notif.msg) * 6;
@@ -67,48 +93,45 @@ void drawSplash() {
 // ══════════════════════════════════════════════════════════
 
 void drawPixelPet(int cx, int cy, char mood, bool large) {
+  petSpriteDraw(cx, cy, mood, large);
+}
+
+void rasterPixelPet(Arduino_GFX* g, int cx, int cy, char mood,
+                    bool large, uint16_t bg) {
   const CreatureDNA& d = creatureDNA;
   int s  = large ? 3 : 2;
-  uint16_t bg = navViewBgColor();
 
   int bw = d.bodyWidth;     // half-width  6-10
   int bh = d.bodyHeight;    // half-height 8-12
-  int bs = d.bellySize;     // belly radius 3-6
 
   // ── Tail (behind body) ────────────────────────────────
   if (d.hasTail) {
     for (int i = 0; i < 3; i++)
-      gfx->fillCircle(cx + d.tailDir * (bw + 1 + i) * s,
-                       cy + (bh - 3 - i) * s, s, d.bodyColor);
+      g->fillCircle(cx + d.tailDir * (bw + 1 + i) * s,
+                     cy + (bh - 3 - i) * s, s, d.bodyColor);
   }
 
-  // ── Body (ellipse) ───────────────────────────────────
-  float bhSq = (float)(bh * bh);
-  for (int r = 0; r <= bh; r++) {
-    int hw = (int)(bw * sqrtf(1.0f - (float)(r * r) / bhSq) + 0.5f);
-    gfx->fillRect(cx - hw * s, cy + r * s, hw * 2 * s, s, d.bodyColor);
-    if (r > 0)
-      gfx->fillRect(cx - hw * s, cy - r * s, hw * 2 * s, s, d.bodyColor);
+  // ── Body + belly (precomputed span tables) ───────────
+  for (int i = 0; i < d.bodySpanCount; i++) {
+    const PetSpan& sp = d.bodySpans[i];
+    g->fillRect(cx - sp.halfW * s, cy + sp.y0 * s,
+                sp.halfW * 2 * s, sp.rows * s, d.bodyColor);
   }
-
-  // ── Belly highlight ──────────────────────────────────
-  float bsSq = (float)(bs * bs);
-  for (int r = 0; r <= bs; r++) {
-    int hw = (int)(bs * sqrtf(1.0f - (float)(r * r) / bsSq) + 0.5f);
-    gfx->fillRect(cx - hw * s, cy + (1 + r) * s, hw * 2 * s, s, d.bellyColor);
-    if (r > 0)
-      gfx->fillRect(cx - hw * s, cy + (1 - r) * s, hw * 2 * s, s, d.bellyColor);
+  for (int i = 0; i < d.bellySpanCount; i++) {
+    const PetSpan& sp = d.bellySpans[i];
+    g->fillRect(cx - sp.halfW * s, cy + sp.y0 * s,
+                sp.halfW * 2 * s, sp.rows * s, d.bellyColor);
   }
 
   // ── Spots ────────────────────────────────────────────
   for (int i = 0; i < d.spotCount; i++)
-    gfx->fillCircle(cx + d.spotX[i] * s,
-                     cy + d.spotY[i] * s, s, d.spotColor);
+    g->fillCircle(cx + d.spotX[i] * s,
+                   cy + d.spotY[i] * s, s, d.spotColor);
 
   // ── Sparkle (time-varying highlight) ─────────────────
   if (d.sparkleVisible)
-    gfx->fillCircle(cx + d.sparkleX * s,
-                     cy + d.sparkleY * s, max(1, s / 2), COL_WHITE);
+    g->fillCircle(cx + d.sparkleX * s,
+                   cy + d.sparkleY * s, max(1, s / 2), COL_WHITE);
 
   // ── Ears ─────────────────────────────────────────────
   int earBaseY = cy - (bh - 2) * s;
@@ -119,30 +142,30 @@ void drawPixelPet(int cx, int cy, char mood, bool large) {
   switch (d.earStyle) {
     case 0: {   // Pointed (cat)
       int tipY = earBaseY - 4 * s;
-      gfx->fillTriangle(earLX - earHW, earBaseY, earLX, tipY,
-                         earLX + earHW, earBaseY, d.bodyColor);
-      gfx->fillTriangle(earRX - earHW, earBaseY, earRX, tipY,
-                         earRX + earHW, earBaseY, d.bodyColor);
+      g->fillTriangle(earLX - earHW, earBaseY, earLX, tipY,
+                       earLX + earHW, earBaseY, d.bodyColor);
+      g->fillTriangle(earRX - earHW, earBaseY, earRX, tipY,
+                       earRX + earHW, earBaseY, d.bodyColor);
       break;
     }
     case 1: {   // Round (bear)
       int earR = earHW + s;
-      gfx->fillCircle(earLX, earBaseY - s, earR, d.bodyColor);
-      gfx->fillCircle(earRX, earBaseY - s, earR, d.bodyColor);
+      g->fillCircle(earLX, earBaseY - s, earR, d.bodyColor);
+      g->fillCircle(earRX, earBaseY - s, earR, d.bodyColor);
       break;
     }
     case 2: {   // Tall (rabbit)
       int tipY    = earBaseY - 7 * s;
       int narrowW = max(1, earHW / 2);
-      gfx->fillTriangle(earLX - narrowW, earBaseY, earLX, tipY,
-                         earLX + narrowW, earBaseY, d.bodyColor);
-      gfx->fillTriangle(earRX - narrowW, earBaseY, earRX, tipY,
-                         earRX + narrowW, earBaseY, d.bodyColor);
+      g->fillTriangle(earLX - narrowW, earBaseY, earLX, tipY,
+                       earLX + narrowW, earBaseY, d.bodyColor);
+      g->fillTriangle(earRX - narrowW, earBaseY, earRX, tipY,
+                       earRX + narrowW, earBaseY, d.bodyColor);
       break;
     }
     case 3: {   // Nubs
-      gfx->fillCircle(earLX, cy - bh * s, earHW, d.bodyColor);
-      gfx->fillCircle(earRX, cy - bh * s, earHW, d.bodyColor);
+      g->fillCircle(earLX, cy - bh * s, earHW, d.bodyColor);
+      g->fillCircle(earRX, cy - bh * s, earHW, d.bodyColor);
       break;
     }
   }
@@ -151,8 +174,8 @@ void drawPixelPet(int cx, int cy, char mood, bool large) {
   if (d.hasTopFin) {
     int finBase = cy - bh * s;
     int finTip  = finBase - 3 * s;
-    gfx->fillTriangle(cx - s, finBase, cx, finTip,
-                       cx + s, finBase, d.bodyColor);
+    g->fillTriangle(cx - s, finBase, cx, finTip,
+                     cx + s, finBase, d.bodyColor);
   }
 
   // ── Eyes ──────────────────────────────────────────────
@@ -162,41 +185,41 @@ void drawPixelPet(int cx, int cy, char mood, bool large) {
 
   if (mood == 's') {
     // Sleeping: horizontal lines
-    gfx->fillRect(eyeLX - s, eyeY, 3 * s, s, bg);
-    gfx->fillRect(eyeRX - s, eyeY, 3 * s, s, bg);
+    g->fillRect(eyeLX - s, eyeY, 3 * s, s, bg);
+    g->fillRect(eyeRX - s, eyeY, 3 * s, s, bg);
   } else {
     switch (d.eyeStyle) {
       case 0:   // Round
-        gfx->fillCircle(eyeLX, eyeY, s + 1, bg);
-        gfx->fillCircle(eyeRX, eyeY, s + 1, bg);
+        g->fillCircle(eyeLX, eyeY, s + 1, bg);
+        g->fillCircle(eyeRX, eyeY, s + 1, bg);
         break;
       case 1: { // Tall
         int eh = s + s / 2;
-        gfx->fillRoundRect(eyeLX - s / 2, eyeY - eh / 2,
-                            s + 1, eh, 1, bg);
-        gfx->fillRoundRect(eyeRX - s / 2, eyeY - eh / 2,
-                            s + 1, eh, 1, bg);
+        g->fillRoundRect(eyeLX - s / 2, eyeY - eh / 2,
+                          s + 1, eh, 1, bg);
+        g->fillRoundRect(eyeRX - s / 2, eyeY - eh / 2,
+                          s + 1, eh, 1, bg);
         break;
       }
       case 2: { // Wide
         int ew = s + s / 2;
-        gfx->fillRoundRect(eyeLX - ew / 2, eyeY - s / 2,
-                            ew, s + 1, 1, bg);
-        gfx->fillRoundRect(eyeRX - ew / 2, eyeY - s / 2,
-                            ew, s + 1, 1, bg);
+        g->fillRoundRect(eyeLX - ew / 2, eyeY - s / 2,
+                          ew, s + 1, 1, bg);
+        g->fillRoundRect(eyeRX - ew / 2, eyeY - s / 2,
+                          ew, s + 1, 1, bg);
         break;
       }
       case 3:   // Dot
-        gfx->fillCircle(eyeLX, eyeY, max(1, s / 2), bg);
-        gfx->fillCircle(eyeRX, eyeY, max(1, s / 2), bg);
+        g->fillCircle(eyeLX, eyeY, max(1, s / 2), bg);
+        g->fillCircle(eyeRX, eyeY, max(1, s / 2), bg);
         break;
     }
     // Eye shine (skip for tiny dots)
     if (d.eyeStyle != 3) {
-      gfx->fillCircle(eyeLX + s / 2, eyeY - s / 2,
-                       max(1, s / 2), COL_WHITE);
-      gfx->fillCircle(eyeRX + s / 2, eyeY - s / 2,
-                       max(1, s / 2), COL_WHITE);
+      g->fillCircle(eyeLX + s / 2, eyeY - s / 2,
+                     max(1, s / 2), COL_WHITE);
+      g->fillCircle(eyeRX + s / 2, eyeY - s / 2,
+                     max(1, s / 2), COL_WHITE);
     }
   }
 
@@ -207,20 +230,20 @@ void drawPixelPet(int cx, int cy, char mood, bool large) {
   if (mood == 'h') {
     for (int i = -mw; i <= mw; i++) {
       int yoff = (i * i) / max(1, mw);
-      gfx->fillRect(cx + i * s, mouthY + yoff * s, s, s, bg);
+      g->fillRect(cx + i * s, mouthY + yoff * s, s, s, bg);
     }
     // Blush cheeks
     int cheekY = cy + (bh / 2) * s;
-    gfx->fillCircle(cx - (d.eyeSpacing + 2) * s, cheekY, s, d.accentColor);
-    gfx->fillCircle(cx + (d.eyeSpacing + 2) * s, cheekY, s, d.accentColor);
+    g->fillCircle(cx - (d.eyeSpacing + 2) * s, cheekY, s, d.accentColor);
+    g->fillCircle(cx + (d.eyeSpacing + 2) * s, cheekY, s, d.accentColor);
   } else if (mood == 'd') {
     for (int i = -mw; i <= mw; i++) {
       int yoff = (i * i) / max(1, mw);
-      gfx->fillRect(cx + i * s, mouthY + s - yoff * s, s, s, bg);
+      g->fillRect(cx + i * s, mouthY + s - yoff * s, s, s, bg);
     }
   } else {
-    gfx->fillRect(cx - (mw - 1) * s, mouthY,
-                   (mw * 2 - 1) * s, s, bg);
+    g->fillRect(cx - (mw - 1) * s, mouthY,
+                 (mw * 2 - 1) * s, s, bg);
   }
 
   // ── Feet ──────────────────────────────────────────────
@@ -230,16 +253,16 @@ void drawPixelPet(int cx, int cy, char mood, bool large) {
 
   switch (d.feetStyle) {
     case 0:   // Round
-      gfx->fillCircle(feetLX, feetY, s + 1, d.bodyColor);
-      gfx->fillCircle(feetRX, feetY, s + 1, d.bodyColor);
+      g->fillCircle(feetLX, feetY, s + 1, d.bodyColor);
+      g->fillCircle(feetRX, feetY, s + 1, d.bodyColor);
       break;
     case 1:   // Small
-      gfx->fillCircle(feetLX, feetY, s, d.bodyColor);
-      gfx->fillCircle(feetRX, feetY, s, d.bodyColor);
+      g->fillCircle(feetLX, feetY, s, d.bodyColor);
+      g->fillCircle(feetRX, feetY, s, d.bodyColor);
       break;
     case 2:   // Wide
-      gfx->fillRoundRect(feetLX - s, feetY, s * 3, s + 1, 1, d.bodyColor);
-      gfx->fillRoundRect(feetRX - s, feetY, s * 3, s + 1, 1, d.bodyColor);
+      g->fillRoundRect(feetLX - s, feetY, s * 3, s + 1, 1, d.bodyColor);
+      g->fillRoundRect(feetRX - s, feetY, s * 3, s + 1, 1, d.bodyColor);
       break;
   }
 }
@@ -263,12 +286,3 @@ void drawViewHeader(const char* title, uint16_t titleCol,
 
   gfx->drawFastHLine(0, 22, SCREEN_W, COL_DIM);
 }
-
-void drawBarWithBorder(int x, int y, int w, int h,
-                       uint8_t val, uint16_t fillCol) {
-  gfx->fillRect(x, y, w, h, COL_BAR_BG);
-  gfx->drawRect(x, y, w, h, COL_DARK);
-  int fw = ((int)val * (w - 2)) / 100;
-  if (fw > 0)
-    gfx->fillRect(x + 1, y + 1, fw, h - 2, fillCol);
-}
@@ -6,6 +6,8 @@
  *
  * drawPixelPet reads from the global creatureDNA
  * to procedurally vary body shape, colours, and features.
+ * It blits through the sprite cache in ui_sprite.h;
+ * rasterPixelPet is the uncached primitive renderer.
  */
 #pragma once
 
@@ -21,9 +23,10 @@ void drawSplash();
 // Pixel pet renderer
 // mood: 'h'appy, 'd'own, 's'leep   large: splash size vs normal
 void drawPixelPet(int cx, int cy, char mood, bool large);
+// Draws the pet with primitives into any GFX target (bg = eye/mouth colour)
+void rasterPixelPet(Arduino_GFX* g, int cx, int cy, char mood,
+                    bool large, uint16_t bg);
 
 // Shared UI elements
 void drawViewHeader(const char* title, uint16_t titleCol,
                     const char* hint,  uint16_t hintCol = COL_DIM);
-void drawBarWithBorder(int x, int y, int w, int h,
-                       uint8_t val, uint16_t fillCol);
@@ -0,0 +1,198 @@
+/*
+ * ui_compose.cpp — Band compositor for game playfields
+ * ──────────────────────────────────────────────────────
+ */
+#include "ui_compose.h"
+#include "ui_text.h"
+
+enum ComposeKind : uint8_t {
+  CMP_RECT,
+  CMP_FRAME,
+  CMP_CIRCLE,
+  CMP_TILES,
+  CMP_BITMAP4,
+  CMP_TEXT,
+};
+
+struct ComposeItem {
+  ComposeKind kind;
+  uint8_t     size;          // circle radius / text size
+  int16_t     x, y, w, h;    // bounding box
+  uint16_t    color;
+  const void* data;          // ComposeTiles* / ComposeBitmap4* / text
+};
+
+// ══════════════════════════════════════════════════════════
+//  STATE
+// ══════════════════════════════════════════════════════════
+
+static DMA_ATTR uint16_t bandBuf[2][COMPOSE_BUF_PX];
+static uint8_t     bandCur = 0;
+
+static ComposeItem items[COMPOSE_MAX_ITEMS];
+static uint8_t     itemCount = 0;
+static int16_t     regX, regY, regW, regH;
+
+static void addItem(ComposeKind kind, int x, int y, int w, int h,
+                    uint16_t color, uint8_t size = 0,
+                    const void* data = nullptr) {
+  if (itemCount >= COMPOSE_MAX_ITEMS) return;
+  // Drop layers that miss the region entirely
+  if (x >= regX + regW || x + w <= regX ||
+      y >= regY + regH || y + h <= regY) return;
+  items[itemCount++] = { kind, size, (int16_t)x, (int16_t)y,
+                         (int16_t)w, (int16_t)h, color, data };
+}
+
+// ══════════════════════════════════════════════════════════
+//  LAYERS
+// ══════════════════════════════════════════════════════════
+
+void composeBegin(int x, int y, int w, int h) {
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  regX = x;
+  regY = y;
+  regW = max(0, min(w, SCREEN_W - x));
+  regH = max(0, min(h, SCREEN_H - y));
+  itemCount = 0;
+}
+
+void composeRect(int x, int y, int w, int h, uint16_t color) {
+  addItem(CMP_RECT, x, y, w, h, color);
+}
+
+void composeFrame(int x, int y, int w, int h, uint16_t color) {
+  addItem(CMP_FRAME, x, y, w, h, color);
+}
+
+void composeCircle(int cx, int cy, int r, uint16_t color) {
+  addItem(CMP_CIRCLE, cx - r, cy - r, 2 * r + 1, 2 * r + 1, color, r);
+}
+
+void composeTiles(const ComposeTiles& t, int x, int y) {
+  addItem(CMP_TILES, x, y, t.cols * t.cellW, t.rows * t.cellH, 0, 0, &t);
+}
+
+void composeBitmap4(const ComposeBitmap4& bm, int x, int y) {
+  addItem(CMP_BITMAP4, x, y, bm.w, bm.h, 0, 0, &bm);
+}
+
+void composeText(int x, int y, const char* str, uint8_t size,
+                 uint16_t color) {
+  size = constrain(size, (uint8_t)1, (uint8_t)3);
+  int w = strlen(str) * TEXT_CHAR_W * size;
+  addItem(CMP_TEXT, x, y, w, TEXT_CHAR_H * size, color, size, str);
+}
+
+// ══════════════════════════════════════════════════════════
+//  RASTERISER
+// ══════════════════════════════════════════════════════════
+
+// Fill screen columns [x0, x1) of one band row, clipped to the region
+static inline void span(uint16_t* row, int x0, int x1, uint16_t c) {
+  if (x0 < regX) x0 = regX;
+  if (x1 > regX + regW) x1 = regX + regW;
+  for (int x = x0; x < x1; x++) row[x - regX] = c;
+}
+
+static void drawItemRow(const ComposeItem& it, uint16_t* row, int y) {
+  int ly = y - it.y;   // row within the item
+  switch (it.kind) {
+    case CMP_RECT:
+      span(row, it.x, it.x + it.w, it.color);
+      break;
+
+    case CMP_FRAME:
+      if (ly == 0 || ly == it.h - 1) {
+        span(row, it.x, it.x + it.w, it.color);
+      } else {
+        span(row, it.x, it.x + 1, it.color);
+        span(row, it.x + it.w - 1, it.x + it.w, it.color);
+      }
+      break;
+
+    case CMP_CIRCLE: {
+      // Same outline as the GFX fillCircle: dx² + dy² ≤ r² + r
+      int r  = it.size;
+      int dy = ly - r;
+      int lim = r * r + r - dy * dy;
+      int hw = 0;
+      while ((hw + 1) * (hw + 1) <= lim) hw++;
+      int cx = it.x + r;
+      span(row, cx - hw, cx + hw + 1, it.color);
+      break;
+    }
+
+    case CMP_TILES: {
+      const ComposeTiles& t = *(const ComposeTiles*)it.data;
+      int ty = ly / t.cellH;
+      int ry = ly % t.cellH;
+      int c0 = max(0, (regX - it.x) / t.cellW);
+      int c1 = min((int)t.cols, (regX + regW - it.x + t.cellW - 1) / t.cellW);
+      for (int c = c0; c < c1; c++) {
+        uint8_t v = t.map[ty * t.cols + c];
+        if (v >= t.styleCount) continue;
+        const ComposeTileStyle& s = t.styles[v];
+        if (s.w == 0 || ry < s.y || ry >= s.y + s.h) continue;
+        int tx = it.x + c * t.cellW + s.x;
+        span(row, tx, tx + s.w, s.color);
+      }
+      break;
+    }
+
+    case CMP_BITMAP4: {
+      const ComposeBitmap4& bm = *(const ComposeBitmap4*)it.data;
+      const uint8_t* src = bm.pix + ly * (bm.w >> 1);
+      int x0 = max((int)it.x, (int)regX);
+      int x1 = min(it.x + it.w, regX + regW);
+      for (int x = x0; x < x1; x++) {
+        int bx = x - it.x;
+        uint8_t b = src[bx >> 1];
+        row[x - regX] = bm.palette[(bx & 1) ? (b & 0x0F) : (b >> 4)];
+      }
+      break;
+    }
+
+    case CMP_TEXT: {
+      const char* str = (const char*)it.data;
+      int gy = ly / it.size;
+      int x  = it.x;
+      for (; *str; str++) {
+        uint8_t bits = textGlyphRow(*str, gy);
+        for (int col = 0; bits && col < 5; col++, bits <<= 1) {
+          if (bits & 0x80) {
+            int px = x + col * it.size;
+            span(row, px, px + it.size, it.color);
+          }
+        }
+        x += TEXT_CHAR_W * it.size;
+      }
+      break;
+    }
+  }
+}
+
+void composeEnd() {
+  if (regW <= 0 || regH <= 0) return;
+
+  int w = regW;
+  int bandRows = COMPOSE_BUF_PX / w;
+
+  for (int y0 = regY; y0 < regY + regH; y0 += bandRows) {
+    int y1 = min(regY + regH, y0 + bandRows);
+    uint16_t* buf = bandBuf[bandCur];
+
+    for (int y = y0; y < y1; y++) {
+      uint16_t* row = buf + (y - y0) * w;
+      for (uint8_t i = 0; i < itemCount; i++) {
+        const ComposeItem& it = items[i];
+        if (y >= it.y && y < it.y + it.h) drawItemRow(it, row, y);
+      }
+    }
+
+    gfx->draw16bitRGBBitmap(regX, y0, buf, w, y1 - y0);
+    bandCur ^= 1;
+  }
+  itemCount = 0;
+}
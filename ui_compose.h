@@ -0,0 +1,64 @@
+/*
+ * ui_compose.h — Band compositor for game playfields
+ * ────────────────────────────────────────────────────
+ * A frame region is described as a short list of layers
+ * (fills, tile maps, 4bpp bitmaps, circles, frames, text) and composited a
+ * band of scanlines at a time into one of two line buffers,
+ * which is then pushed as a single window.  Overdraw happens
+ * in RAM only, so erase-then-redraw never reaches the panel.
+ *
+ *   composeBegin(x, y, w, h);
+ *   composeRect(...); composeTiles(...); composeCircle(...);
+ *   composeEnd();                 // rasterise + push
+ *
+ * Layers are painted in the order they are added; the first
+ * should cover the whole region (usually its background), as
+ * the buffers are not cleared between frames.  Pointers
+ * handed in (text, tile maps) must stay valid until
+ * composeEnd().  The two buffers alternate per band so a bus
+ * that transmits asynchronously can send one while the next
+ * band is built in the other.
+ */
+#pragma once
+
+#include "types.h"
+
+#define COMPOSE_MAX_ITEMS  16
+#define COMPOSE_BUF_PX     (SCREEN_W * 4)   // per buffer: 960 px / 1920 bytes
+
+// One tile value's look: a rect inside the cell (w == 0 → none)
+struct ComposeTileStyle {
+  uint16_t color;
+  uint8_t  x, y, w, h;
+};
+
+// Row-major tile map; cells are cellW × cellH on screen
+struct ComposeTiles {
+  const uint8_t*          map;
+  uint8_t                 cols, rows;
+  uint8_t                 cellW, cellH;
+  const ComposeTileStyle* styles;      // indexed by tile value
+  uint8_t                 styleCount;
+};
+
+// Packed 4bpp bitmap (even x in the high nibble, w even) whose
+// pixels index a small RGB565 palette — e.g. a cached background
+struct ComposeBitmap4 {
+  const uint8_t*  pix;
+  uint16_t        w, h;
+  const uint16_t* palette;
+};
+
+// Start a frame for the clip region (nothing outside is touched)
+void composeBegin(int x, int y, int w, int h);
+
+void composeRect(int x, int y, int w, int h, uint16_t color);
+void composeFrame(int x, int y, int w, int h, uint16_t color);
+void composeCircle(int cx, int cy, int r, uint16_t color);
+void composeTiles(const ComposeTiles& tiles, int x, int y);
+void composeBitmap4(const ComposeBitmap4& bm, int x, int y);
+void composeText(int x, int y, const char* str, uint8_t size,
+                 uint16_t color);   // transparent background
+
+// Rasterise every band of the region and push it
+void composeEnd();
@@ -0,0 +1,249 @@
+/*
+ * ui_damage.cpp — Dirty-rectangle compositor
+ * ────────────────────────────────────────────
+ * ClipGFX sits in front of the real display while a damaged
+ * region is redrawn: every primitive the view issues is
+ * clipped to that region before it is forwarded, so SPI
+ * traffic scales with the damaged area, not the view.
+ */
+#include "ui_damage.h"
+#include "nav.h"   // navDrawView, navViewBgColor
+
+// ══════════════════════════════════════════════════════════
+//  CLIPPING GFX WRAPPER
+// ══════════════════════════════════════════════════════════
+
+class ClipGFX : public Arduino_GFX {
+public:
+  ClipGFX() : Arduino_GFX(SCREEN_W, SCREEN_H) {}
+
+  void attach(Arduino_GFX* target, const DamageRect& clip) {
+    _target = target;
+    _cx0 = clip.x;          _cy0 = clip.y;
+    _cx1 = clip.x + clip.w; _cy1 = clip.y + clip.h;   // exclusive
+  }
+
+  bool begin(int32_t) override { return true; }
+
+  void startWrite() override { _target->startWrite(); }
+  void endWrite()   override { _target->endWrite(); }
+
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override {
+    if (x >= _cx0 && x < _cx1 && y >= _cy0 && y < _cy1)
+      _target->writePixelPreclipped(x, y, color);
+  }
+
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h,
+                               uint16_t color) override {
+    int16_t x0 = max(x, _cx0), y0 = max(y, _cy0);
+    int16_t x1 = min((int16_t)(x + w), _cx1);
+    int16_t y1 = min((int16_t)(y + h), _cy1);
+    if (x1 > x0 && y1 > y0)
+      _target->writeFillRectPreclipped(x0, y0, x1 - x0, y1 - y0, color);
+  }
+
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+    writeFillRectPreclipped(x, y, w, 1, color);
+  }
+
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+    writeFillRectPreclipped(x, y, 1, h, color);
+  }
+
+  // Bitmaps: one push when fully inside, else one push per clipped row
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap,
+                          int16_t w, int16_t h) override {
+    int16_t x0 = max(x, _cx0), y0 = max(y, _cy0);
+    int16_t x1 = min((int16_t)(x + w), _cx1);
+    int16_t y1 = min((int16_t)(y + h), _cy1);
+    if (x1 <= x0 || y1 <= y0) return;
+    if (x0 == x && x1 == x + w) {
+      _target->draw16bitRGBBitmap(x, y0, bitmap + (y0 - y) * w, w, y1 - y0);
+      return;
+    }
+    for (int16_t row = y0; row < y1; row++)
+      _target->draw16bitRGBBitmap(x0, row, bitmap + (row - y) * w + (x0 - x),
+                                  x1 - x0, 1);
+  }
+
+private:
+  Arduino_GFX* _target = nullptr;
+  int16_t _cx0 = 0, _cy0 = 0, _cx1 = 0, _cy1 = 0;
+};
+
+static ClipGFX clipper;
+
+// ══════════════════════════════════════════════════════════
+//  CAPTURING GFX (renders a region into RAM)
+// ══════════════════════════════════════════════════════════
+
+class CaptureGFX : public Arduino_GFX {
+public:
+  CaptureGFX() : Arduino_GFX(SCREEN_W, SCREEN_H) {}
+
+  void attach(uint16_t* buf, const DamageRect& r) {
+    _buf = buf;
+    _cx0 = r.x;       _cy0 = r.y;
+    _cx1 = r.x + r.w; _cy1 = r.y + r.h;
+  }
+
+  bool begin(int32_t) override { return true; }
+
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override {
+    if (x >= _cx0 && x < _cx1 && y >= _cy0 && y < _cy1)
+      _buf[(y - _cy0) * (_cx1 - _cx0) + (x - _cx0)] = color;
+  }
+
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h,
+                               uint16_t color) override {
+    int16_t x0 = max(x, _cx0), y0 = max(y, _cy0);
+    int16_t x1 = min((int16_t)(x + w), _cx1);
+    int16_t y1 = min((int16_t)(y + h), _cy1);
+    for (int16_t row = y0; row < y1; row++) {
+      uint16_t* p = _buf + (row - _cy0) * (_cx1 - _cx0) - _cx0;
+      for (int16_t col = x0; col < x1; col++) p[col] = color;
+    }
+  }
+
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+    writeFillRectPreclipped(x, y, w, 1, color);
+  }
+
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+    writeFillRectPreclipped(x, y, 1, h, color);
+  }
+
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap,
+                          int16_t w, int16_t h) override {
+    int16_t x0 = max(x, _cx0), y0 = max(y, _cy0);
+    int16_t x1 = min((int16_t)(x + w), _cx1);
+    int16_t y1 = min((int16_t)(y + h), _cy1);
+    if (x1 <= x0) return;
+    for (int16_t row = y0; row < y1; row++)
+      memcpy(_buf + (row - _cy0) * (_cx1 - _cx0) + (x0 - _cx0),
+             bitmap + (row - y) * w + (x0 - x), (x1 - x0) * sizeof(uint16_t));
+  }
+
+private:
+  uint16_t* _buf = nullptr;
+  int16_t _cx0 = 0, _cy0 = 0, _cx1 = 0, _cy1 = 0;
+};
+
+static CaptureGFX capturer;
+
+// ══════════════════════════════════════════════════════════
+//  DAMAGE LIST
+// ══════════════════════════════════════════════════════════
+
+static DamageRect rects[DAMAGE_MAX_RECTS];
+static int        rectCount = 0;
+static bool       redrawing = false;
+
+static int area(const DamageRect& r) { return (int)r.w * r.h; }
+
+static DamageRect unite(const DamageRect& a, const DamageRect& b) {
+  int16_t x0 = min(a.x, b.x), y0 = min(a.y, b.y);
+  int16_t x1 = max((int16_t)(a.x + a.w), (int16_t)(b.x + b.w));
+  int16_t y1 = max((int16_t)(a.y + a.h), (int16_t)(b.y + b.h));
+  return { x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+}
+
+// Overlapping or edge-touching
+static bool touches(const DamageRect& a, const DamageRect& b) {
+  return a.x <= b.x + b.w && b.x <= a.x + a.w &&
+         a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+void damageAdd(int x, int y, int w, int h) {
+  // Clip to screen
+  int x1 = min(x + w, SCREEN_W), y1 = min(y + h, SCREEN_H);
+  x = max(x, 0);  y = max(y, 0);
+  if (x1 <= x || y1 <= y) return;
+  DamageRect r = { (int16_t)x, (int16_t)y, (int16_t)(x1 - x), (int16_t)(y1 - y) };
+
+  // Absorb every rect the new one touches; repeat until stable,
+  // since a grown rect may now reach ones it didn't before
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (int i = 0; i < rectCount; i++) {
+      if (touches(r, rects[i])) {
+        r = unite(r, rects[i]);
+        rects[i] = rects[--rectCount];
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  if (rectCount < DAMAGE_MAX_RECTS) {
+    rects[rectCount++] = r;
+    return;
+  }
+
+  // List full: fold into the rect whose union grows the least
+  int best = 0, bestGrow = INT32_MAX;
+  for (int i = 0; i < rectCount; i++) {
+    int grow = area(unite(r, rects[i])) - area(rects[i]);
+    if (grow < bestGrow) { bestGrow = grow; best = i; }
+  }
+  rects[best] = unite(r, rects[best]);
+}
+
+void damageClear() {
+  rectCount = 0;
+}
+
+bool damagePending() {
+  return rectCount > 0;
+}
+
+// ══════════════════════════════════════════════════════════
+//  REDRAW
+// ══════════════════════════════════════════════════════════
+
+static void redraw(const DamageRect& r) {
+  Arduino_GFX* panel = gfx;
+  clipper.attach(panel, r);
+  gfx = &clipper;
+  redrawing = true;
+  gfx->fillRect(r.x, r.y, r.w, r.h, navViewBgColor());
+  navDrawView();
+  redrawing = false;
+  gfx = panel;
+
+  // The view redraw painted over the notification box
+  static const DamageRect notifBox = { 6, 28, 228, 22 };
+  if (notif.active && touches(r, notifBox)) notif.drawn = false;
+}
+
+bool damageRedrawing() {
+  return redrawing;
+}
+
+void damageRedrawRect(int x, int y, int w, int h) {
+  DamageRect r = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+  redraw(r);
+}
+
+void damageCapture(int x, int y, int w, int h, uint16_t* buf) {
+  DamageRect r = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+  Arduino_GFX* panel = gfx;
+  capturer.attach(buf, r);
+  gfx = &capturer;
+  redrawing = true;     // nothing reaches the panel: commit nothing
+  gfx->fillRect(r.x, r.y, r.w, r.h, navViewBgColor());
+  navDrawView();
+  redrawing = false;
+  gfx = panel;
+}
+
+void damageFlush() {
+  // Copy first: a view's draw code may register new damage
+  DamageRect pending[DAMAGE_MAX_RECTS];
+  int n = rectCount;
+  memcpy(pending, rects, sizeof(DamageRect) * n);
+  rectCount = 0;
+
+  for (int i = 0; i < n; i++) redraw(pending[i]);
+}
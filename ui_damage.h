@@ -0,0 +1,47 @@
+/*
+ * ui_damage.h — Dirty-rectangle compositor
+ * ──────────────────────────────────────────
+ * Views register invalidated rectangles instead of setting
+ * viewDirty.  Overlapping/touching rects are merged, and on
+ * flush each merged region is cleared and the current view is
+ * redrawn through a clipping GFX wrapper, so only the damaged
+ * pixels ever reach the panel.
+ *
+ * Full redraws (view switch) still go through viewDirty.
+ */
+#pragma once
+
+#include "types.h"
+
+#define DAMAGE_MAX_RECTS  8
+
+struct DamageRect {
+  int16_t x, y, w, h;
+};
+
+// Register a region of the current view as stale
+void damageAdd(int x, int y, int w, int h);
+
+// Drop pending damage (a full redraw supersedes it)
+void damageClear();
+
+bool damagePending();
+
+// Redraw all pending regions of the current view (called from loop)
+void damageFlush();
+
+// Immediately redraw one region of the current view, clipped
+void damageRedrawRect(int x, int y, int w, int h);
+
+// True while a view Draw runs only to repaint a clipped region
+// (or to capture one into RAM).
+// Only part of what it issues reaches the panel, so retained
+// state (field caches, last ball position…) must not be
+// committed, and the Draw must not advance game state.
+bool damageRedrawing();
+
+// Render one region of the current view into buf (w × h,
+// row-major) instead of the panel — what lies under an overlay.
+// Runs the view Draw in damageRedrawing() mode: no game state
+// advances and no field / ball / maze cache is touched.
+void damageCapture(int x, int y, int w, int h, uint16_t* buf);
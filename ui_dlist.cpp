@@ -0,0 +1,125 @@
+/*
+ * ui_dlist.cpp — Display lists for static view chrome
+ * ─────────────────────────────────────────────────────
+ */
+#include "ui_dlist.h"
+
+#define DLIST_INITIAL_CAP  64
+
+// ══════════════════════════════════════════════════════════
+//  RECORDER
+// ══════════════════════════════════════════════════════════
+
+class DListRecorder : public Arduino_GFX {
+public:
+  DListRecorder() : Arduino_GFX(SCREEN_W, SCREEN_H) {}
+
+  void attach(DisplayList* list) { _list = list; _failed = false; }
+  bool failed() const { return _failed; }
+
+  bool begin(int32_t) override { return true; }
+
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override {
+    add(x, y, 1, 1, color);
+  }
+
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h,
+                               uint16_t color) override {
+    add(x, y, w, h, color);
+  }
+
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+    writeFillRect(x, y, w, 1, color);
+  }
+
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+    writeFillRect(x, y, 1, h, color);
+  }
+
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap,
+                          int16_t w, int16_t h) override {
+    for (int16_t j = 0; j < h; j++)
+      for (int16_t i = 0; i < w; i++)
+        writePixel(x + i, y + j, bitmap[j * w + i]);
+  }
+
+private:
+  void add(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (_failed || w <= 0 || h <= 0) return;
+    DisplayList& l = *_list;
+
+    // Extend the previous op when this one continues it
+    if (l.count > 0) {
+      DListOp& p = l.ops[l.count - 1];
+      if (p.color == color) {
+        if (p.y == y && p.h == h && p.x + p.w == x) { p.w += w; return; }
+        if (p.x == x && p.w == w && p.y + p.h == y) { p.h += h; return; }
+      }
+    }
+
+    if (l.count == l.cap) {
+      uint16_t cap = l.cap ? l.cap * 2 : DLIST_INITIAL_CAP;
+      DListOp* ops = (DListOp*)realloc(l.ops, cap * sizeof(DListOp));
+      if (!ops) { _failed = true; return; }
+      l.ops = ops;
+      l.cap = cap;
+    }
+    l.ops[l.count++] = { (uint8_t)x, (uint8_t)w, (uint16_t)y, (uint16_t)h, color };
+  }
+
+  DisplayList* _list   = nullptr;
+  bool         _failed = false;
+};
+
+static DListRecorder recorder;
+
+// ══════════════════════════════════════════════════════════
+//  PUBLIC
+// ══════════════════════════════════════════════════════════
+
+static void record(DisplayList& list, void (*draw)()) {
+  list.count = 0;
+  recorder.attach(&list);
+
+  Arduino_GFX* target = gfx;
+  gfx = &recorder;
+  draw();
+  gfx = target;
+
+  if (recorder.failed()) {
+    dlistInvalidate(list);
+    Serial.printf("[DLIST] %s: out of heap, drawing direct\n", list.name);
+    return;
+  }
+  // Trim the growth slack
+  if (DListOp* ops = (DListOp*)realloc(list.ops, list.count * sizeof(DListOp))) {
+    list.ops = ops;
+    list.cap = list.count;
+  }
+  list.recorded = true;
+  Serial.printf("[DLIST] %s: recorded %u ops (%u B)\n", list.name,
+                list.count, (unsigned)(list.count * sizeof(DListOp)));
+}
+
+void dlistDraw(DisplayList& list, void (*draw)()) {
+  if (!list.recorded) record(list, draw);
+  if (!list.recorded) { draw(); return; }
+
+  uint32_t t0 = micros();
+  gfx->startWrite();
+  for (uint16_t i = 0; i < list.count; i++) {
+    const DListOp& op = list.ops[i];
+    gfx->writeFillRectPreclipped(op.x, op.y, op.w, op.h, op.color);
+  }
+  gfx->endWrite();
+  list.lastUs = micros() - t0;
+  list.replays++;
+}
+
+void dlistInvalidate(DisplayList& list) {
+  free(list.ops);
+  list.ops      = nullptr;
+  list.count    = 0;
+  list.cap      = 0;
+  list.recorded = false;
+}
@@ -0,0 +1,44 @@
+/*
+ * ui_dlist.h — Display lists for static view chrome
+ * ───────────────────────────────────────────────────
+ * A view's never-changing primitives (header, card frames,
+ * labels) are recorded once into a compact list of solid
+ * rects, then replayed on every later full redraw inside one
+ * startWrite/endWrite pair — no round-rect arcs or glyph
+ * bitmaps are re-derived.
+ *
+ * Recording runs the view's own chrome function against a
+ * capturing GFX, so existing drawing code needs no changes.
+ * Adjacent same-colour rects (glyph columns, arc runs) are
+ * merged while recording, so each op is one SPI window.
+ *
+ * Each list keeps its op count, replay count and last replay
+ * time; the recorded size is logged as "[DLIST] <name> …".
+ */
+#pragma once
+
+#include "types.h"
+
+// One solid rect (x/w fit in a byte on the 240 px wide panel)
+struct DListOp {
+  uint8_t  x, w;
+  uint16_t y, h;
+  uint16_t color;
+};
+
+struct DisplayList {
+  const char* name;
+  DListOp*    ops      = nullptr;
+  uint16_t    count    = 0;
+  uint16_t    cap      = 0;
+  bool        recorded = false;
+  uint32_t    replays  = 0;
+  uint32_t    lastUs   = 0;   // duration of the last replay
+};
+
+// Replay list, recording it from draw() on first use.  Falls
+// back to calling draw() directly if the list can't be stored.
+void dlistDraw(DisplayList& list, void (*draw)());
+
+// Drop the recording (chrome changed); re-recorded on next draw
+void dlistInvalidate(DisplayList& list);
@@ -6,65 +6,84 @@
 #include "ui_feed.h"
 #include "ui_common.h"
 #include "creature_gen.h"
+#include "ui_damage.h"
+#include "ui_dlist.h"
+#include "ui_field.h"
 
-void uiFeedDraw() {
-  drawViewHeader("FEED", COL_GREEN, "A=SCROLL B=SEL");
+// ── Cards (unselected look is static chrome) ─────────────
+static void drawFoodCard(int i, bool sel) {
+  int col = i % 3;
+  int row = i / 3;
+  int x = 6 + col * 78;
+  int y = 28 + row * 68;
 
-  // Food grid: 3 columns × 2 rows
-  for (int i = 0; i < 6; i++) {
-    int col = i % 3;
-    int row = i / 3;
-    int x = 6 + col * 78;
-    int y = 28 + row * 68;
-    bool sel = (i == selectedFood);
-
-    if (sel) {
-      gfx->fillRoundRect(x, y, 72, 62, 4, COL_FEED_SEL);
-      gfx->drawRoundRect(x, y, 72, 62, 4, COL_GREEN);
-    } else {
-      gfx->fillRoundRect(x, y, 72, 62, 4, COL_BAR_BG);
-      gfx->drawRoundRect(x, y, 72, 62, 4, COL_DIM);
-    }
-
-    // Icon
-    gfx->setTextColor(sel ? COL_WHITE : COL_DIM);
-    gfx->setTextSize(2);
-    int iw = strlen(foods[i].icon) * 12;
-    gfx->setCursor(x + (72 - iw)/2, y + 8);
-    gfx->print(foods[i].icon);
-
-    // Name
-    gfx->setTextColor(sel ? COL_WHITE : COL_DIM);
-    gfx->setTextSize(1);
-    int nw = strlen(foods[i].name) * 6;
-    gfx->setCursor(x + (72 - nw)/2, y + 32);
-    gfx->print(foods[i].name);
-
-    // Points
-    char buf[10]; sprintf(buf, "+%d", foods[i].pts);
-    gfx->setTextColor(COL_GREEN);
-    int pw = strlen(buf) * 6;
-    gfx->setCursor(x + (72 - pw)/2, y + 46);
-    gfx->print(buf);
+  if (sel) {
+    gfx->fillRoundRect(x, y, 72, 62, 4, COL_FEED_SEL);
+    gfx->drawRoundRect(x, y, 72, 62, 4, COL_GREEN);
+  } else {
+    gfx->fillRoundRect(x, y, 72, 62, 4, COL_BAR_BG);
+    gfx->drawRoundRect(x, y, 72, 62, 4, COL_DIM);
   }
 
-  // BACK option (7th item)
-  {
-    int x = 6, y = 28 + 2 * 68;
-    bool sel = (selectedFood == 6);
-    gfx->fillRoundRect(x, y, 228, 24, 4, sel ? COL_DARK : COL_BAR_BG);
-    gfx->drawRoundRect(x, y, 228, 24, 4, sel ? COL_CYAN : COL_DIM);
-    gfx->setTextColor(sel ? COL_CYAN : COL_DIM);
-    gfx->setTextSize(1);
-    gfx->setCursor(x + 84, y + 8);
-    gfx->print("< BACK >");
-  }
+  // Icon
+  gfx->setTextColor(sel ? COL_WHITE : COL_DIM);
+  gfx->setTextSize(2);
+  int iw = strlen(foods[i].icon) * 12;
+  gfx->setCursor(x + (72 - iw)/2, y + 8);
+  gfx->print(foods[i].icon);
+
+  // Name
+  gfx->setTextColor(sel ? COL_WHITE : COL_DIM);
+  gfx->setTextSize(1);
+  int nw = strlen(foods[i].name) * 6;
+  gfx->setCursor(x + (72 - nw)/2, y + 32);
+  gfx->print(foods[i].name);
+
+  // Points
+  char buf[10]; sprintf(buf, "+%d", foods[i].pts);
+  gfx->setTextColor(COL_GREEN);
+  int pw = strlen(buf) * 6;
+  gfx->setCursor(x + (72 - pw)/2, y + 46);
+  gfx->print(buf);
+}
+
+// BACK option (7th item)
+static void drawBackRow(bool sel) {
+  int x = 6, y = 28 + 2 * 68;
+  gfx->fillRoundRect(x, y, 228, 24, 4, sel ? COL_DARK : COL_BAR_BG);
+  gfx->drawRoundRect(x, y, 228, 24, 4, sel ? COL_CYAN : COL_DIM);
+  gfx->setTextColor(sel ? COL_CYAN : COL_DIM);
+  gfx->setTextSize(1);
+  gfx->setCursor(x + 84, y + 8);
+  gfx->print("< BACK >");
+}
+
+static BarField hungerBar = { 60, 224, 140, 7 };
+
+// Header, every card + BACK unselected, hunger label — recorded
+// once; the selected card is drawn over it live
+static DisplayList chrome = { "feed" };
+
+static void drawChrome() {
+  drawViewHeader("FEED", COL_GREEN, "A=SCROLL B=SEL");
+  for (int i = 0; i < 6; i++) drawFoodCard(i, false);
+  drawBackRow(false);
+
+  gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
+  gfx->setCursor(8, 224);     gfx->print("HUNGER:");
+}
+
+void uiFeedDraw() {
+  dlistDraw(chrome, drawChrome);
+
+  // Food grid: 3 columns × 2 rows + BACK — restyle the selection
+  if (selectedFood < 6) drawFoodCard(selectedFood, true);
+  else                  drawBackRow(true);
 
   // Hunger bar
   int barY = 224;
-  gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
-  gfx->setCursor(8, barY);    gfx->print("HUNGER:");
-  drawBarWithBorder(60, barY, 140, 7, pet.hunger, COL_ORANGE);
+  barInvalidate(hungerBar);
+  barSetValue(hungerBar, pet.hunger, COL_ORANGE);
   char hbuf[6]; sprintf(hbuf, "%d%%", pet.hunger);
   gfx->setTextColor(COL_ORANGE); gfx->setCursor(206, barY); gfx->print(hbuf);
 
@@ -79,3 +98,23 @@ void uiFeedDraw() {
     gfx->print("Press B to go back");
   }
 }
+
+// ══════════════════════════════════════════════════════════
+//  CURSOR MOVE (partial — only the two cards + prompt)
+// ══════════════════════════════════════════════════════════
+
+static void damageItem(int i) {
+  if (i == 6) {
+    damageAdd(6, 28 + 2 * 68, 228, 24);   // BACK row
+  } else {
+    damageAdd(6 + (i % 3) * 78, 28 + (i / 3) * 68, 72, 62);
+  }
+}
+
+void uiFeedDamageCursor(int prevSel, int newSel) {
+  damageItem(prevSel);
+  damageItem(newSel);
+  // Prompt text switches between "feed" and "go back"
+  if ((prevSel == 6) != (newSel == 6))
+    damageAdd(0, 238, SCREEN_W, 12);
+}
@@ -6,3 +6,4 @@
 #include "types.h"
 
 void uiFeedDraw();   // full draw
+void uiFeedDamageCursor(int prevSel, int newSel);  // invalidate changed cards
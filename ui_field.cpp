@@ -0,0 +1,126 @@
+/*
+ * ui_field.cpp — Change-aware text & bar fields
+ * ───────────────────────────────────────────────
+ */
+#include "ui_field.h"
+#include "ui_text.h"
+#include "ui_compose.h"
+#include "ui_damage.h"
+
+// ══════════════════════════════════════════════════════════
+//  TEXT FIELDS
+// ══════════════════════════════════════════════════════════
+
+// Lay s out in exactly f.width chars according to f.align
+static void layout(const TextField& f, const char* s, char* out) {
+  int w   = min((int)f.width, FIELD_MAX_CHARS);
+  int len = min((int)strlen(s), w);
+  int lead = (f.align == FIELD_RIGHT)  ? w - len
+           : (f.align == FIELD_CENTER) ? (w - len) / 2 : 0;
+  memset(out, ' ', w);
+  memcpy(out + lead, s, len);
+  out[w] = '\0';
+}
+
+void fieldInvalidate(TextField& f) {
+  if (!damageRedrawing()) f.valid = false;
+}
+
+void fieldSetText(TextField& f, const char* s) {
+  char next[FIELD_MAX_CHARS + 1];
+  layout(f, s, next);
+  int w    = strlen(next);
+  int cell = TEXT_CHAR_W * f.size;
+
+  if (!f.valid || damageRedrawing()) {
+    textRun(f.x, f.y, next, f.size, f.fg, f.bg);
+  } else {
+    // Push each run of changed characters as one text run
+    int i = 0;
+    while (i < w) {
+      if (next[i] == f.shown[i]) { i++; continue; }
+      int j = i;
+      while (j < w && next[j] != f.shown[j]) j++;
+      char run[FIELD_MAX_CHARS + 1];
+      memcpy(run, next + i, j - i);
+      run[j - i] = '\0';
+      textRun(f.x + i * cell, f.y, run, f.size, f.fg, f.bg);
+      i = j;
+    }
+  }
+  if (damageRedrawing()) return;   // clipped: panel only partly updated
+  memcpy(f.shown, next, w + 1);
+  f.valid = true;
+}
+
+void fieldSetInt(TextField& f, int32_t v) {
+  char buf[12];
+  fmtInt(buf, v);
+  fieldSetText(f, buf);
+}
+
+void fieldSetColor(TextField& f, uint16_t fg) {
+  if (f.fg == fg) return;
+  f.fg    = fg;
+  f.valid = false;   // every glyph needs the new colour
+}
+
+// ══════════════════════════════════════════════════════════
+//  BAR FIELDS
+// ══════════════════════════════════════════════════════════
+
+void barInvalidate(BarField& b) {
+  if (!damageRedrawing()) b.valid = false;
+}
+
+// Paint inner columns [x0, x1): fill colour left of the fill
+// edge, track right of it (caption composited on top)
+static void paintSpan(const BarField& b, int x0, int x1, int fill,
+                      uint16_t fillCol) {
+  if (x1 <= x0) return;
+  int bw = b.framed ? 1 : 0;
+  int ix = b.x + bw, iy = b.y + bw;
+  int iw = b.w - 2 * bw, ih = b.h - 2 * bw;
+  int split = ix + fill;
+
+  if (b.label) {
+    composeBegin(x0, iy, x1 - x0, ih);
+    composeRect(ix, iy, fill, ih, fillCol);
+    composeRect(split, iy, iw - fill, ih, b.track);
+    composeText(b.labelX, b.labelY, b.label, b.labelSize, b.labelCol);
+    composeEnd();
+    return;
+  }
+  if (split > x0) gfx->fillRect(x0, iy, min(split, x1) - x0, ih, fillCol);
+  if (split < x1) {
+    int t0 = max(split, x0);
+    gfx->fillRect(t0, iy, x1 - t0, ih, b.track);
+  }
+}
+
+void barSetFraction(BarField& b, int32_t num, int32_t den,
+                    uint16_t fillCol) {
+  int bw    = b.framed ? 1 : 0;
+  int ix    = b.x + bw;
+  int inner = b.w - 2 * bw;
+  int fill  = (den > 0) ? (int)((int64_t)constrain(num, (int32_t)0, den) * inner / den) : 0;
+
+  if (!b.valid || damageRedrawing()) {
+    if (b.framed) gfx->drawRect(b.x, b.y, b.w, b.h, b.frame);
+    paintSpan(b, ix, ix + inner, fill, fillCol);
+  } else if (fillCol != b.shownCol) {
+    paintSpan(b, ix, ix + max(fill, (int)b.shownFill), fill, fillCol);
+  } else if (fill != b.shownFill) {
+    paintSpan(b, ix + min(fill, (int)b.shownFill),
+                 ix + max(fill, (int)b.shownFill), fill, fillCol);
+  }
+
+  if (damageRedrawing()) return;   // clipped: panel only partly updated
+  b.shownFill = fill;
+  b.shownCol  = fillCol;
+  b.valid     = true;
+}
+
+void barSetValue(BarField& b, uint8_t val, uint16_t fillCol) {
+  barSetFraction(b, val, 100, fillCol);
+}
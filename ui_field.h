@@ -0,0 +1,63 @@
+/*
+ * ui_field.h — Change-aware text & bar fields
+ * ─────────────────────────────────────────────
+ * Retained widgets that remember what they last put on the
+ * panel and repaint only the difference:
+ *   TextField  fixed-width text; only changed characters are
+ *              re-pushed (as opaque text runs)
+ *   BarField   progress bar / timer / meter; only the grown or
+ *              shrunk strip is filled, and the fill is
+ *              recoloured only when its colour band changes
+ *
+ * A view's full draw must call fieldInvalidate / barInvalidate
+ * (the screen under the widget was just cleared) before
+ * setting values; per-tick updates then cost almost nothing.
+ * During a clipped damage redraw fields paint in full but keep
+ * their cache: only part of the paint reaches the panel.
+ */
+#pragma once
+
+#include "types.h"
+
+#define FIELD_MAX_CHARS  24
+
+enum FieldAlign : uint8_t { FIELD_LEFT, FIELD_RIGHT, FIELD_CENTER };
+
+struct TextField {
+  int16_t    x, y;
+  uint8_t    size;         // text size 1-3
+  uint8_t    width;        // reserved characters
+  uint16_t   fg, bg;
+  FieldAlign align = FIELD_LEFT;
+  char       shown[FIELD_MAX_CHARS + 1] = "";
+  bool       valid = false;
+};
+
+struct BarField {
+  int16_t     x, y, w, h;            // outer rect (incl. border if framed)
+  uint16_t    track  = COL_BAR_BG;   // unfilled part
+  uint16_t    frame  = COL_DARK;     // 1 px border colour
+  bool        framed = true;
+  // Optional caption kept on top of the bar (strips that cross
+  // it are composited with it, so it is never wiped)
+  const char* label     = nullptr;
+  int16_t     labelX    = 0, labelY = 0;
+  uint8_t     labelSize = 1;
+  uint16_t    labelCol  = COL_WHITE;
+
+  int16_t     shownFill = 0;         // inner fill width on the panel
+  uint16_t    shownCol  = 0;
+  bool        valid     = false;
+};
+
+// Text fields
+void fieldInvalidate(TextField& f);
+void fieldSetText(TextField& f, const char* s);
+void fieldSetInt(TextField& f, int32_t v);
+void fieldSetColor(TextField& f, uint16_t fg);
+
+// Bar fields
+void barInvalidate(BarField& b);
+void barSetValue(BarField& b, uint8_t val, uint16_t fillCol);   // 0-100
+void barSetFraction(BarField& b, int32_t num, int32_t den,
+                    uint16_t fillCol);                          // num/den
@@ -0,0 +1,98 @@
+/*
+ * ui_halfres.cpp — Half-resolution playfield canvas
+ * ───────────────────────────────────────────────────
+ * Rows are doubled into one of two band buffers (two pixels
+ * per 32-bit store, then the row copied below itself) and
+ * pushed as one window per band; the buffers alternate so an
+ * asynchronous bus can send one while the next is built.
+ */
+#include "ui_halfres.h"
+
+static DMA_ATTR uint16_t bandBuf[2][HALF_BAND_PX] __attribute__((aligned(4)));
+static uint8_t  bandCur = 0;
+
+HalfCanvas::HalfCanvas(int16_t sx, int16_t sy, int16_t w, int16_t h)
+  : Arduino_GFX(w, h), _sx(sx), _sy(sy), _cw(w), _ch(h) {}
+
+bool HalfCanvas::begin(int32_t) {
+  if (!_buf) _buf = (uint16_t*)malloc(_cw * _ch * sizeof(uint16_t));
+  return _buf != nullptr;
+}
+
+bool HalfCanvas::ready() {
+  if (!_tried) {
+    _tried = true;
+    if (!begin()) Serial.println("[HALFRES] No heap for canvas, full-res path");
+  }
+  return _buf != nullptr;
+}
+
+// ══════════════════════════════════════════════════════════
+//  DRAWING
+// ══════════════════════════════════════════════════════════
+
+void HalfCanvas::writePixelPreclipped(int16_t x, int16_t y, uint16_t color) {
+  _buf[y * _cw + x] = color;
+}
+
+void HalfCanvas::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w,
+                                         int16_t h, uint16_t color) {
+  for (int16_t row = y; row < y + h; row++) {
+    uint16_t* p = _buf + row * _cw + x;
+    for (int16_t i = 0; i < w; i++) p[i] = color;
+  }
+}
+
+void HalfCanvas::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (y < 0 || y >= _ch) return;
+  if (x < 0) { w += x; x = 0; }
+  if (x + w > _cw) w = _cw - x;
+  if (w > 0) writeFillRectPreclipped(x, y, w, 1, color);
+}
+
+void HalfCanvas::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if (x < 0 || x >= _cw) return;
+  if (y < 0) { h += y; y = 0; }
+  if (y + h > _ch) h = _ch - y;
+  if (h > 0) writeFillRectPreclipped(x, y, 1, h, color);
+}
+
+void HalfCanvas::fillScreen(uint16_t color) {
+  if (_buf) writeFillRectPreclipped(0, 0, _cw, _ch, color);
+}
+
+// ══════════════════════════════════════════════════════════
+//  PRESENT (2× upscale)
+// ══════════════════════════════════════════════════════════
+
+void HalfCanvas::present(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (!_buf) return;
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > _cw) w = _cw - x;
+  if (y + h > _ch) h = _ch - y;
+  if (w <= 0 || h <= 0) return;
+
+  int outW     = w * 2;
+  int bandRows = HALF_BAND_PX / (outW * 2);   // half-res rows per band
+
+  for (int y0 = y; y0 < y + h; y0 += bandRows) {
+    int y1 = min(y + h, y0 + bandRows);
+    uint16_t* buf = bandBuf[bandCur];
+
+    for (int row = y0; row < y1; row++) {
+      const uint16_t* src = _buf + row * _cw + x;
+      uint16_t* line = buf + (row - y0) * 2 * outW;
+      uint32_t* out  = (uint32_t*)line;
+      for (int i = 0; i < w; i++) {
+        uint32_t c = src[i];
+        out[i] = c | (c << 16);
+      }
+      memcpy(line + outW, line, outW * sizeof(uint16_t));
+    }
+
+    gfx->draw16bitRGBBitmap(_sx + x * 2, _sy + y0 * 2, buf,
+                            outW, (y1 - y0) * 2);
+    bandCur ^= 1;
+  }
+}
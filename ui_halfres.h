@@ -0,0 +1,54 @@
+/*
+ * ui_halfres.h — Half-resolution playfield canvas
+ * ─────────────────────────────────────────────────
+ * An off-screen RGB565 canvas at half the width and height of
+ * the screen rectangle it stands for (a quarter of the pixels,
+ * so a whole game playfield fits in RAM).  Views draw into it
+ * with ordinary GFX calls in canvas coordinates; present()
+ * pixel-doubles rows while streaming them through `gfx`, so a
+ * damage clip or the indexed framebuffer still applies.
+ *
+ *   static HalfCanvas field(GAME_X, GAME_Y, GAME_W / 2, GAME_H / 2);
+ *   if (field.ready()) { field.fillRect(...); field.present(); }
+ *
+ * The buffer is allocated on the first ready() and kept; if
+ * the heap can't spare it, ready() stays false and the view
+ * falls back to its full-resolution path.
+ *
+ * Enabled per view with PLAYFIELD_HALF_RES in config.h.
+ */
+#pragma once
+
+#include "types.h"
+
+#define HALF_BAND_PX  (SCREEN_W * 4)   // per push buffer (screen px)
+
+class HalfCanvas : public Arduino_GFX {
+public:
+  // Screen origin (sx, sy) and canvas size in half-res pixels
+  HalfCanvas(int16_t sx, int16_t sy, int16_t w, int16_t h);
+
+  bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+  bool ready();
+
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h,
+                               uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+
+  // Push canvas rect [x, x+w) × [y, y+h) at 2× (clipped to the canvas)
+  void present(int16_t x, int16_t y, int16_t w, int16_t h);
+  void present() { present(0, 0, _cw, _ch); }
+
+  // Screen ↔ canvas coordinates
+  int16_t toX(int sx) const { return (sx - _sx) >> 1; }
+  int16_t toY(int sy) const { return (sy - _sy) >> 1; }
+
+private:
+  int16_t   _sx, _sy;       // screen origin
+  int16_t   _cw, _ch;       // canvas size (half-res px)
+  uint16_t* _buf = nullptr;
+  bool      _tried = false; // allocation attempted
+};
@@ -8,22 +8,56 @@
 #include "creature_gen.h"
 #include "pet.h"
 #include "nav.h"
+#include "ui_text.h"
+#include "ui_field.h"
+#include "ui_asset.h"
+#include "asset_pak.h"
+
+// ── Retained fields (repaint only what changed) ───────────
+#define STAT_PANEL_Y  188
+
+static TextField clockField = { 8,   8,   1, 5, COL_CYAN,   COL_BG_MAIN };
+static TextField heartField = { 178, 8,   1, 2, COL_PINK,   COL_BG_MAIN };
+static TextField moodField  = { 96,  168, 1, 8, COL_YELLOW, COL_BG_MAIN,
+                                FIELD_CENTER };
+static TextField statNum[4] = {
+  { 204, STAT_PANEL_Y +  0 + 2, 1, 3, COL_DIM, COL_BG_MAIN, FIELD_RIGHT },
+  { 204, STAT_PANEL_Y + 13 + 2, 1, 3, COL_DIM, COL_BG_MAIN, FIELD_RIGHT },
+  { 204, STAT_PANEL_Y + 26 + 2, 1, 3, COL_DIM, COL_BG_MAIN, FIELD_RIGHT },
+  { 204, STAT_PANEL_Y + 39 + 2, 1, 3, COL_DIM, COL_BG_MAIN, FIELD_RIGHT },
+};
+static BarField statBar[4] = {
+  { 36, STAT_PANEL_Y +  0 + 1, 162, 7 },
+  { 36, STAT_PANEL_Y + 13 + 1, 162, 7 },
+  { 36, STAT_PANEL_Y + 26 + 1, 162, 7 },
+  { 36, STAT_PANEL_Y + 39 + 1, 162, 7 },
+};
+
+static void invalidateFields() {
+  fieldInvalidate(clockField);
+  fieldInvalidate(heartField);
+  fieldInvalidate(moodField);
+  for (int i = 0; i < 4; i++) {
+    fieldInvalidate(statNum[i]);
+    barInvalidate(statBar[i]);
+  }
+}
 
 // ── Local helpers ─────────────────────────────────────────
-static void drawStatusBar() {
-  uint16_t bg = COL_BG_MAIN;
+static void updateClockHeart() {
   uint32_t sec = millis() / 1000;
   char tbuf[6];
-  sprintf(tbuf, "%02d:%02d", (int)(sec/3600)%24, (int)(sec/60)%60);
-  gfx->setTextColor(COL_CYAN);  gfx->setTextSize(1);
-  gfx->setCursor(8, 8);         gfx->print(tbuf);
-
-  gfx->setTextColor(COL_PINK);
-  gfx->setCursor(178, 8);
-  gfx->print(animFrame ? "<3" : " 3");
+  fmtInt(tbuf,     (sec / 3600) % 24, 2, '0');
+  tbuf[2] = ':';
+  fmtInt(tbuf + 3, (sec / 60) % 60,   2, '0');
+  fieldSetText(clockField, tbuf);
+  fieldSetText(heartField, animFrame ? "<3" : " 3");
 
   gfx->fillCircle(225, 11, 3, animFrame ? COL_GREEN : COL_DIM);
+}
 
+static void drawStatusBar() {
+  updateClockHeart();
   gfx->drawFastHLine(0, 22, SCREEN_W, COL_DIM);
 }
 
@@ -41,24 +75,37 @@ static void drawDecorStars() {
   }
 }
 
+// Dotted ground: one 200×1 asset from the partition (one
+// window), else plotted point by point
 static void drawGroundLine() {
+  const uint8_t* art = pakGet(PAK_GROUND);
+  if (art) {
+    assetDraw(art, 20, 183);
+    return;
+  }
   for (int x = 20; x < 220; x += 2) {
     uint16_t gc = (x < 50 || x > 190) ? COL_DARK : COL_DIM;
     gfx->drawPixel(x, 183, gc);
   }
 }
 
-static void drawPetNameMood() {
+static void drawPetName() {
   gfx->setTextColor(creatureDNA.bodyColor);
   gfx->setTextSize(1);
   int nameW = strlen(creatureDNA.name) * 6;
   gfx->setCursor((SCREEN_W - nameW) / 2, 154);
   gfx->print(creatureDNA.name);
+}
 
-  gfx->setTextColor(COL_YELLOW);
-  const char* ms = petGetMoodString();
-  gfx->setCursor((SCREEN_W - (int)strlen(ms)*6)/2, 168);
-  gfx->print(ms);
+static void drawStatLabels() {
+  gfx->drawFastHLine(0, STAT_PANEL_Y - 2, SCREEN_W, COL_DIM);
+
+  const char* lbls[] = {"HP  ", "FOOD", "JOY ", "NRG "};
+  gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
+  for (int i = 0; i < 4; i++) {
+    gfx->setCursor(6, STAT_PANEL_Y + i * 13 + 2);
+    gfx->print(lbls[i]);
+  }
 }
 
 // ══════════════════════════════════════════════════════════
@@ -66,11 +113,14 @@ static void drawPetNameMood() {
 // ══════════════════════════════════════════════════════════
 
 void uiMainDraw() {
+  invalidateFields();
   drawStatusBar();
   drawDecorStars();
   drawPixelPet(120, 112, petGetMood(), false);
-  drawPetNameMood();
+  drawPetName();
+  fieldSetText(moodField, petGetMoodString());
   drawGroundLine();
+  drawStatLabels();
   uiMainDrawStatBars();
   uiMainDrawActionBar();
 }
@@ -80,27 +130,12 @@ void uiMainDraw() {
 // ══════════════════════════════════════════════════════════
 
 void uiMainDrawStatBars() {
-  uint16_t bg = navViewBgColor();
-  int panelY = 188;
-
-  gfx->drawFastHLine(0, panelY - 2, SCREEN_W, COL_DIM);
-
-  const char*    lbls[] = {"HP  ", "FOOD", "JOY ", "NRG "};
   const uint8_t  vals[] = {pet.hp, pet.hunger, pet.happy, pet.energy};
   const uint16_t cols[] = {COL_GREEN, COL_ORANGE, COL_PINK, COL_CYAN};
 
   for (int i = 0; i < 4; i++) {
-    int y = panelY + i * 13;
-
-    gfx->fillRect(0, y, SCREEN_W, 12, bg);
-
-    gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
-    gfx->setCursor(6, y + 2);   gfx->print(lbls[i]);
-
-    drawBarWithBorder(36, y + 1, 162, 7, vals[i], cols[i]);
-
-    char b[5]; sprintf(b, "%3d", vals[i]);
-    gfx->setTextColor(COL_DIM); gfx->setCursor(204, y + 2); gfx->print(b);
+    barSetValue(statBar[i], vals[i], cols[i]);
+    fieldSetInt(statNum[i], vals[i]);
   }
 }
 
@@ -156,32 +191,18 @@ void uiMainDrawActionBar() {
 void uiMainAnimate() {
   uint16_t bg = COL_BG_MAIN;
 
-  // Clear pet + mood area
-  gfx->fillRect(30, 68, 180, 116, bg);
-
-  if (animFrame) {
-    gfx->drawPixel(55, 75, COL_WHITE);
-    gfx->drawPixel(170, 82, COL_WHITE);
-  }
+  // Twinkle (erase in bg on the off frame — no area clear needed)
+  uint16_t tw = animFrame ? COL_WHITE : bg;
+  gfx->drawPixel(55, 75, tw);
+  gfx->drawPixel(170, 82, tw);
 
+  // Cached sprite blit; its bob margin overwrites the old frame
   int petY = animFrame ? 114 : 110;
   drawPixelPet(120, petY, petGetMood(), false);
-  drawPetNameMood();
-  drawGroundLine();
-
-  // Update clock area
-  gfx->fillRect(8, 4, 40, 14, bg);
-  uint32_t sec = millis() / 1000;
-  char tbuf[6];
-  sprintf(tbuf, "%02d:%02d", (int)(sec/3600)%24, (int)(sec/60)%60);
-  gfx->setTextColor(COL_CYAN); gfx->setTextSize(1);
-  gfx->setCursor(8, 8); gfx->print(tbuf);
 
-  // Heartbeat
-  gfx->fillRect(174, 4, 30, 14, bg);
-  gfx->setTextColor(COL_PINK);
-  gfx->setCursor(178, 8);
-  gfx->print(animFrame ? "<3" : " 3");
+  // Mood text (name never changes between full draws)
+  fieldSetText(moodField, petGetMoodString());
 
-  gfx->fillCircle(225, 11, 3, animFrame ? COL_GREEN : COL_DIM);
+  // Clock + heartbeat
+  updateClockHeart();
 }
@@ -2,12 +2,87 @@
  * ui_play.cpp — Play view (Catch the Star)
  * ──────────────────────────────────────────
  * Draws game area, star, scores. Animation updates timer bar.
+ * A catch or timeout is incremental: both star boxes are
+ * recomposited, the score digits repaint in place and the
+ * timer bar resets — the chrome is never touched.
  */
 #include "ui_play.h"
 #include "ui_common.h"
 #include "game_star.h"
+#include "ui_compose.h"
+#include "ui_dlist.h"
+#include "ui_field.h"
+#include "ui_halfres.h"
 
-void uiPlayDraw() {
+// Star timer: unframed delta bar
+static BarField timerBar = { 20, 148, 200, 5, COL_DARK, COL_DIM, false };
+
+static void drawTimerBar() {
+  int32_t rem = constrain((int32_t)(starGame.showUntil - millis()), (int32_t)0, (int32_t)2200);
+  uint16_t bc = (rem > 1000) ? COL_GREEN : (rem > 500 ? COL_YELLOW : COL_PINK);
+  barSetFraction(timerBar, rem, 2200, bc);
+}
+
+// Score digits (score panel fill / view bg behind them)
+static TextField scoreField = { 18,  210, 2, 4, COL_PINK,   COL_BAR_BG };
+static TextField bestField  = { 134, 210, 2, 4, COL_YELLOW, COL_BAR_BG };
+static TextField joyField   = { 50,  236, 1, 4, COL_PINK,   COL_BG_PLAY };
+
+static void updateScores() {
+  fieldSetInt(scoreField, starGame.score);
+  fieldSetInt(bestField,  starGame.bestScore);
+  fieldSetInt(joyField,   starGame.score * 2);
+}
+
+// Star glyph is the ui_text atlas '*' at size 3: 18×24 px, drawn
+// only through composeStarBox() so full and incremental paints
+// match.  The hint line sits inside the area a low star can reach.
+#define STAR_W   18
+#define STAR_H   24
+#define HINT_Y   158
+
+static void drawHint() {
+  gfx->setTextSize(1); gfx->setTextColor(COL_DIM);
+  gfx->setCursor(60, HINT_Y);
+  gfx->print("[A] TAP TO CATCH!");
+}
+
+// One star-sized box: play bg + the current star, one window
+static void composeStarBox(int x, int y) {
+  composeBegin(x, y, STAR_W, STAR_H);
+  composeRect(x, y, STAR_W, STAR_H, COL_PLAY_BG);
+  if (starGame.visible)
+    composeText(starGame.x, starGame.y, "*", 3, COL_YELLOW);
+  composeEnd();
+}
+
+// ── Half-resolution star field ───────────────────────────
+// With PLAYFIELD_HALF_RES the open part of the game area (below
+// the title, clear of the rounded corners) is a 104×63 canvas
+// and the star a doubled sparkle inside its 18×24 box.
+#if PLAYFIELD_HALF_RES
+#define FIELD_X  16
+#define FIELD_Y  48
+static HalfCanvas field(FIELD_X, FIELD_Y, 104, 63);
+
+static void fieldPaintStar(int x, int y, uint16_t c) {
+  int hx = field.toX(x + 9), hy = field.toY(y + 12);
+  field.drawFastHLine(hx - 4, hy, 9, c);
+  field.drawFastVLine(hx, hy - 4, 9, c);
+  field.drawLine(hx - 3, hy - 3, hx + 3, hy + 3, c);
+  field.drawLine(hx - 3, hy + 3, hx + 3, hy - 3, c);
+}
+
+// Canvas rect covering a star box (x, y, STAR_W, STAR_H)
+static void fieldPresentStar(int x, int y) {
+  field.present(field.toX(x), field.toY(y), STAR_W / 2 + 1, STAR_H / 2 + 1);
+}
+#endif
+
+// Header, game area, score panel frames and labels — recorded once
+static DisplayList chrome = { "play" };
+
+static void drawChrome() {
   drawViewHeader("PLAY", COL_PINK, "A=CATCH B=BACK");
 
   // Game area
@@ -17,75 +92,91 @@ void uiPlayDraw() {
   gfx->setTextColor(COL_PINK); gfx->setTextSize(1);
   gfx->setCursor(52, 38);       gfx->print("CATCH THE STAR!");
 
-  // Check timeout before drawing
-  starGameCheckTimeout();
-
-  if (starGame.visible) {
-    gfx->setTextColor(COL_YELLOW); gfx->setTextSize(3);
-    gfx->setCursor(starGame.x, starGame.y);
-    gfx->print("*");
-
-    // Timer bar
-    uint32_t rem = starGame.showUntil - millis();
-    int bw = constrain((int)map((long)rem, 0L, 2200L, 0L, 200L), 0, 200);
-    gfx->fillRect(20, 148, 200, 5, COL_DARK);
-    uint16_t bc = (rem > 1000) ? COL_GREEN : (rem > 500 ? COL_YELLOW : COL_PINK);
-    if (bw > 0) gfx->fillRect(20, 148, bw, 5, bc);
-
-    gfx->setTextSize(1); gfx->setTextColor(COL_DIM);
-    gfx->setCursor(60, 158);
-    gfx->print("[A] TAP TO CATCH!");
-  } else {
-    gfx->setTextSize(1); gfx->setTextColor(COL_DIM);
-    gfx->setCursor(68, 100);
-    gfx->print("WAIT FOR IT...");
-  }
-
   // Score panels
   gfx->drawFastHLine(0, 182, SCREEN_W, COL_DIM);
 
-  // SCORE
   gfx->fillRoundRect(8,  188, 108, 40, 4, COL_BAR_BG);
   gfx->drawRoundRect(8,  188, 108, 40, 4, COL_PLAY_BDR);
   gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
   gfx->setCursor(18, 194);    gfx->print("SCORE");
-  gfx->setTextColor(COL_PINK); gfx->setTextSize(2);
-  char sbuf[8]; sprintf(sbuf, "%d", starGame.score);
-  gfx->setCursor(18, 210);    gfx->print(sbuf);
 
-  // BEST
   gfx->fillRoundRect(124, 188, 108, 40, 4, COL_BAR_BG);
   gfx->drawRoundRect(124, 188, 108, 40, 4, COL_PLAY_BDR);
-  gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
   gfx->setCursor(134, 194);   gfx->print("BEST");
-  gfx->setTextColor(COL_YELLOW); gfx->setTextSize(2);
-  sprintf(sbuf, "%d", starGame.bestScore);
-  gfx->setCursor(134, 210);   gfx->print(sbuf);
 
-  // Joy earned
-  gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
   gfx->setCursor(8, 236);     gfx->print("JOY +");
-  gfx->setTextColor(COL_PINK);
-  sprintf(sbuf, "%d", starGame.score * 2);
-  gfx->setCursor(50, 236);    gfx->print(sbuf);
-
-  gfx->setTextColor(COL_DIM);
   gfx->setCursor(42, 260);    gfx->print("B = BACK TO MAIN");
 }
 
+void uiPlayDraw() {
+  dlistDraw(chrome, drawChrome);
+  // No timeout check here: a clipped damage redraw runs this too.
+  // uiPlayAnimate() owns timeouts and repaints them incrementally.
+
+#if PLAYFIELD_HALF_RES
+  if (field.ready()) {
+    field.fillScreen(COL_PLAY_BG);
+    if (starGame.visible) fieldPaintStar(starGame.x, starGame.y, COL_YELLOW);
+    field.present();
+  }
+#endif
+
+  if (starGame.visible) {
+#if PLAYFIELD_HALF_RES
+    if (!field.ready())
+#endif
+    {
+      composeStarBox(starGame.x, starGame.y);   // same glyph as catch / timeout
+    }
+
+    // Timer bar
+    barInvalidate(timerBar);
+    drawTimerBar();
+    drawHint();
+  } else {
+    gfx->setTextSize(1); gfx->setTextColor(COL_DIM);
+    gfx->setCursor(68, 100);
+    gfx->print("WAIT FOR IT...");
+  }
+
+  // Scores + joy earned
+  fieldInvalidate(scoreField);
+  fieldInvalidate(bestField);
+  fieldInvalidate(joyField);
+  updateScores();
+}
+
 void uiPlayAnimate() {
   if (currentView != VIEW_PLAY) return;
 
+  int oldX = starGame.x, oldY = starGame.y;
   if (starGameCheckTimeout()) {
-    viewDirty = true;
+    uiPlayUpdateStar(oldX, oldY);
     return;
   }
 
-  if (starGame.visible) {
-    uint32_t rem = starGame.showUntil - millis();
-    int bw = constrain((int)map((long)rem, 0L, 2200L, 0L, 200L), 0, 200);
-    gfx->fillRect(20, 148, 200, 5, COL_DARK);
-    uint16_t bc = (rem > 1000) ? COL_GREEN : (rem > 500 ? COL_YELLOW : COL_PINK);
-    if (bw > 0) gfx->fillRect(20, 148, bw, 5, bc);
+  if (starGame.visible) drawTimerBar();
+}
+
+// Catch / timeout: recomposite both star boxes, then the few
+// widgets that changed
+void uiPlayUpdateStar(int oldX, int oldY) {
+#if PLAYFIELD_HALF_RES
+  if (field.ready()) {
+    fieldPaintStar(oldX, oldY, COL_PLAY_BG);
+    fieldPaintStar(starGame.x, starGame.y, COL_YELLOW);
+    fieldPresentStar(oldX, oldY);
+    fieldPresentStar(starGame.x, starGame.y);
+  } else
+#endif
+  {
+    composeStarBox(oldX, oldY);
+    composeStarBox(starGame.x, starGame.y);
   }
+
+  // A box that reached the hint line wiped part of it
+  if (max(oldY, starGame.y) + STAR_H > HINT_Y && starGame.visible) drawHint();
+  barInvalidate(timerBar);
+  drawTimerBar();
+  updateScores();
 }
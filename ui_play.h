@@ -7,3 +7,4 @@
 
 void uiPlayDraw();      // full draw
 void uiPlayAnimate();   // partial: timer bar + star timeout
+void uiPlayUpdateStar(int oldX, int oldY);  // star moved / score changed
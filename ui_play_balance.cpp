@@ -6,7 +6,12 @@
 #include "ui_play_balance.h"
 #include "game_balance.h"
 #include "ui_common.h"
+#include "pet.h"
 #include "nav.h"
+#include "ui_field.h"
+#include "ui_compose.h"
+#include "ui_halfres.h"
+#include "ui_damage.h"
 
 // Maze rendering geometry (fits within 240x280 screen)
 #define GAME_X      8    // Game area x offset
@@ -26,29 +31,50 @@
 //  HELPERS
 // ══════════════════════════════════════════════════════════
 
-static void drawMazeCell(int cx, int cy, uint8_t cellType) {
-  int px = GAME_X + cx * CELL_W;
-  int py = GAME_Y + cy * CELL_H;
-  // Always clear full cell area first
-  gfx->fillRect(px, py, CELL_W - 1, CELL_H - 1, COL_CELL_C);
-  if (cellType == MAZE_WALL) {
-    int ww, wh;
-    balanceGameGetWallDrawSize(ww, wh);
-    int offX = ((CELL_W - 1) - ww) / 2;
-    int offY = ((CELL_H - 1) - wh) / 2;
-    gfx->fillRect(px + offX, py + offY, ww, wh, COL_WALL_C);
-  } else if (cellType == MAZE_GOAL) {
-    gfx->fillRect(px, py, CELL_W - 1, CELL_H - 1, COL_GOAL_C);
-  }
+// Tile looks per maze cell type (wall inset depends on level)
+static ComposeTileStyle mazeStyles[3];
+static ComposeTiles     mazeTiles = { nullptr, 10, 8, CELL_W, CELL_H,
+                                      mazeStyles, 3 };
+
+static void updateMazeTiles() {
+  int ww, wh;
+  balanceGameGetWallDrawSize(ww, wh);
+  uint8_t offX = ((CELL_W - 1) - ww) / 2;
+  uint8_t offY = ((CELL_H - 1) - wh) / 2;
+  mazeStyles[MAZE_EMPTY] = { COL_CELL_C, 0, 0, 0, 0 };
+  mazeStyles[MAZE_WALL]  = { COL_WALL_C, offX, offY, (uint8_t)ww, (uint8_t)wh };
+  mazeStyles[MAZE_GOAL]  = { COL_GOAL_C, 0, 0, CELL_W - 1, CELL_H - 1 };
+  mazeTiles.map = balanceGameGetMazePattern();
 }
 
-static void drawMazeFull() {
-  const uint8_t* maze = balanceGameGetMazePattern();
-  for (int y = 0; y < 8; y++)
-    for (int x = 0; x < 10; x++)
-      drawMazeCell(x, y, maze[y * 10 + x]);
-  // Border around maze
-  gfx->drawRect(GAME_X - 1, GAME_Y - 1, GAME_W + 2, GAME_H + 2, COL_DIM);
+// ── Background cache ─────────────────────────────────────
+// The rendered maze as a 4bpp bitmap (tile value = palette
+// index), rebuilt on each full draw.  Ball frames copy their
+// patch of it instead of re-deriving cells.  Only allocated
+// while the game is on screen (uiPlayBalanceExit frees it).
+static const uint16_t mazePalette[3] = { COL_CELL_C, COL_WALL_C, COL_GOAL_C };
+static uint8_t*       mazeCache = nullptr;
+static ComposeBitmap4 mazeBitmap = { nullptr, GAME_W, GAME_H, mazePalette };
+
+static void buildMazeCache() {
+  if (!mazeCache) mazeCache = (uint8_t*)malloc(GAME_W * GAME_H / 2);
+  mazeBitmap.pix = mazeCache;   // composeMaze checks this
+  if (!mazeCache) return;       // no heap: compose from the tile layer
+
+  memset(mazeCache, 0, GAME_W * GAME_H / 2);
+  for (int cy = 0; cy < 8; cy++) {
+    for (int cx = 0; cx < 10; cx++) {
+      uint8_t v = mazeTiles.map[cy * 10 + cx];
+      const ComposeTileStyle& st = mazeStyles[v];
+      if (v == MAZE_EMPTY || st.w == 0) continue;
+      for (int y = cy * CELL_H + st.y; y < cy * CELL_H + st.y + st.h; y++) {
+        uint8_t* rowp = mazeCache + y * (GAME_W / 2);
+        for (int x = cx * CELL_W + st.x; x < cx * CELL_W + st.x + st.w; x++)
+          rowp[x >> 1] = (x & 1) ? ((rowp[x >> 1] & 0xF0) | v)
+                                 : ((rowp[x >> 1] & 0x0F) | (v << 4));
+      }
+    }
+  }
 }
 
 static void gameToScreen(float bx, float by, int& sx, int& sy) {
@@ -58,38 +84,82 @@ static void gameToScreen(float bx, float by, int& sx, int& sy) {
   sy = constrain(sy, GAME_Y + 3, GAME_Y + GAME_H - 3);
 }
 
-static void drawBallAt(float bx, float by, uint16_t color) {
-  int sx, sy;
-  gameToScreen(bx, by, sx, sy);
-  gfx->fillCircle(sx, sy, 3, color);
+// Composite cells + ball for the playfield rows/cols [x0,x1)×[y0,y1)
+// (clipped to the maze so the border is never touched) — one push,
+// nothing is erased on the panel first.
+static void composeMaze(int x0, int y0, int x1, int y1, int sx, int sy) {
+  x0 = max(x0, GAME_X);          y0 = max(y0, GAME_Y);
+  x1 = min(x1, GAME_X + GAME_W); y1 = min(y1, GAME_Y + GAME_H);
+  if (x1 <= x0 || y1 <= y0) return;
+
+  composeBegin(x0, y0, x1 - x0, y1 - y0);
+  if (mazeBitmap.pix) {
+    composeBitmap4(mazeBitmap, GAME_X, GAME_Y);
+  } else {
+    composeRect(GAME_X, GAME_Y, GAME_W, GAME_H, COL_CELL_C);
+    composeTiles(mazeTiles, GAME_X, GAME_Y);
+  }
+  composeCircle(sx, sy, 3, COL_BALL_C);
+  composeEnd();
 }
 
-// Erase the ball by filling the bounding box with background color,
-// then redrawing all cells in that region. This ensures grid line pixels
-// (the gaps between cells) are fully cleared before cells are redrawn.
-static void eraseBallAt(float bx, float by) {
-  int sx, sy;
-  gameToScreen(bx, by, sx, sy);
+// ── Half-resolution playfield ────────────────────────────
+// With PLAYFIELD_HALF_RES the whole maze lives in a 112×80
+// canvas (cells 11×10); a ball move repaints the cells under
+// the old ball in RAM and presents just the two ball boxes.
+#if PLAYFIELD_HALF_RES
+static HalfCanvas field(GAME_X, GAME_Y, GAME_W / 2, GAME_H / 2);
+
+#define HCELL_W  (CELL_W / 2)
+#define HCELL_H  (CELL_H / 2)
+
+// Repaint every cell touching canvas rect [x0,x1)×[y0,y1)
+static void fieldPaintCells(int x0, int y0, int x1, int y1) {
+  int c0 = max(0, x0 / HCELL_W), c1 = min(9, (x1 - 1) / HCELL_W);
+  int r0 = max(0, y0 / HCELL_H), r1 = min(7, (y1 - 1) / HCELL_H);
+  for (int cy = r0; cy <= r1; cy++) {
+    for (int cx = c0; cx <= c1; cx++) {
+      int hx = cx * HCELL_W, hy = cy * HCELL_H;
+      field.fillRect(hx, hy, HCELL_W, HCELL_H, COL_CELL_C);
+      uint8_t v = mazeTiles.map[cy * 10 + cx];
+      const ComposeTileStyle& st = mazeStyles[v];
+      if (v == MAZE_EMPTY || st.w == 0) continue;
+      field.fillRect(hx + st.x / 2, hy + st.y / 2,
+                     max(1, st.w / 2), max(1, st.h / 2), st.color);
+    }
+  }
+}
+
+// Ball: 4×4 with the corners knocked off (8×8 on screen)
+static void fieldPaintBall(int hx, int hy) {
+  field.fillRect(hx - 2, hy - 1, 4, 2, COL_BALL_C);
+  field.fillRect(hx - 1, hy - 2, 2, 4, COL_BALL_C);
+}
+
+static void fieldMoveBall(int px, int py, int hx, int hy) {
+  fieldPaintCells(px - 2, py - 2, px + 2, py + 2);
+  fieldPaintBall(hx, hy);
+  if (abs(px - hx) < 4 && abs(py - hy) < 4) {
+    int x0 = min(px, hx) - 2, y0 = min(py, hy) - 2;
+    field.present(x0, y0, max(px, hx) + 2 - x0, max(py, hy) + 2 - y0);
+  } else {
+    field.present(px - 2, py - 2, 4, 4);
+    field.present(hx - 2, hy - 2, 4, 4);
+  }
+}
+#endif
 
-  // Ball's pixel bounding box (radius 3px)
-  int left = sx - 3;
-  int right = sx + 3;
-  int top = sy - 3;
-  int bottom = sy + 3;
-
-  // Fill the entire bounding box with background color to erase all ball pixels
-  gfx->fillRect(left, top, right - left + 1, bottom - top + 1, COL_CELL_C);
-
-  // Now redraw all cells that overlap with the bounding box
-  const uint8_t* maze = balanceGameGetMazePattern();
-  int cxMin = constrain((left - GAME_X) / CELL_W, 0, 9);
-  int cxMax = constrain((right - GAME_X) / CELL_W, 0, 9);
-  int cyMin = constrain((top - GAME_Y) / CELL_H, 0, 7);
-  int cyMax = constrain((bottom - GAME_Y) / CELL_H, 0, 7);
-
-  for (int cy = cyMin; cy <= cyMax; cy++)
-    for (int cx = cxMin; cx <= cxMax; cx++)
-      drawMazeCell(cx, cy, maze[cy * 10 + cx]);
+static BarField timerBar = { 20, GAME_Y + GAME_H + 20, 200, 5, COL_DARK, COL_DIM };
+
+static void drawTimerBar() {
+  uint32_t timeLimit = balanceGame->levelTimeLimit;
+  uint32_t timeLeft = timeLimit;
+  if (balanceGame->levelStartTime > 0) {
+    uint32_t elapsed = millis() - balanceGame->levelStartTime;
+    timeLeft = (elapsed < timeLimit) ? timeLimit - elapsed : 0;
+  }
+  uint16_t tc = (timeLeft > timeLimit / 2) ? COL_GREEN : (timeLeft > timeLimit / 4 ? COL_YELLOW : COL_PINK);
+  barSetFraction(timerBar, timeLeft, timeLimit, tc);
 }
 
 // ══════════════════════════════════════════════════════════
@@ -99,24 +169,56 @@ static void eraseBallAt(float bx, float by) {
 // Track previous ball position so we can erase it without full redraw
 static float prevBallX = -1, prevBallY = -1;
 
+// Score changes when a level completes; repaint digits only then
+static TextField scoreField = { 112, GAME_Y + GAME_H + 14, 1, 6,
+                                COL_YELLOW, COL_BG_PLAY };
+
 // ══════════════════════════════════════════════════════════
 //  FULL DRAW (on view entry)
 // ══════════════════════════════════════════════════════════
 
+void uiPlayBalanceEnter() {
+  prevBallX = prevBallY = -1;   // new maze: nothing of it on the panel yet
+}
+
+void uiPlayBalanceExit() {
+  free(mazeCache);              // 17.9 KB back to the heap
+  mazeCache      = nullptr;
+  mazeBitmap.pix = nullptr;
+}
+
 void uiPlayBalanceDraw() {
   drawViewHeader("TILT MAZE", COL_CYAN, "TILT=MOVE  B=BACK");
 
-  // ─── MAZE ─────────────────────────────────────────────
-  gfx->fillRect(GAME_X, GAME_Y, GAME_W, GAME_H, COL_CELL_C);
-  drawMazeFull();
-
-  // ─── BALL ─────────────────────────────────────────────
-  float ballX = balanceGameGetBallX();
-  float ballY = balanceGameGetBallY();
-  drawBallAt(ballX, ballY, COL_BALL_C);
-  prevBallX = ballX;
-  prevBallY = ballY;
-  Serial.printf("[BALANCE_UI] Full redraw: ball at (%.1f, %.1f)\n", ballX, ballY);
+  // ─── MAZE + BALL ───────────────────────────────────────
+  // The first paint of a maze (view entry, new level, or any
+  // unclipped draw) fixes where the ball is drawn; clipped
+  // redraws — slide strips included — repaint it there, so the
+  // next animate erases it in the right place
+  bool first = prevBallX < 0 || !damageRedrawing();
+  if (first) {
+    prevBallX = balanceGameGetBallX();
+    prevBallY = balanceGameGetBallY();
+  }
+  int sx, sy;
+  gameToScreen(prevBallX, prevBallY, sx, sy);
+  updateMazeTiles();
+#if PLAYFIELD_HALF_RES
+  if (field.ready()) {
+    fieldPaintCells(0, 0, GAME_W / 2, GAME_H / 2);
+    fieldPaintBall(field.toX(sx), field.toY(sy));
+    field.present();
+  } else
+#endif
+  {
+    if (first) buildMazeCache();
+    composeMaze(GAME_X, GAME_Y, GAME_X + GAME_W, GAME_Y + GAME_H, sx, sy);
+  }
+  gfx->drawRect(GAME_X - 1, GAME_Y - 1, GAME_W + 2, GAME_H + 2, COL_DIM);
+  if (!damageRedrawing()) {
+    Serial.printf("[BALANCE_UI] Full redraw: ball at (%.1f, %.1f)\n",
+                  prevBallX, prevBallY);
+  }
 
   // ─── INFO BAR ─────────────────────────────────────────
   gfx->drawFastHLine(0, GAME_Y + GAME_H + 4, SCREEN_W, COL_DIM);
@@ -125,27 +227,15 @@ void uiPlayBalanceDraw() {
   gfx->setCursor(8, GAME_Y + GAME_H + 14);
   gfx->printf("Lv%d  Score:", balanceGameGetLevel());
 
-  gfx->setTextColor(COL_YELLOW); gfx->setTextSize(1);
-  char sbuf[8]; sprintf(sbuf, "%d", balanceGameGetScore());
-  gfx->setCursor(112, GAME_Y + GAME_H + 14);
-  gfx->print(sbuf);
+  fieldInvalidate(scoreField);
+  fieldSetInt(scoreField, balanceGameGetScore());
 
   gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
   gfx->setCursor(SCREEN_W - 70, GAME_Y + GAME_H + 14);
   gfx->printf("Best:%d", balanceGame->bestScore);
 
-  // Timer bar
-  uint32_t timeLimit = balanceGame->levelTimeLimit;
-  uint32_t timeLeft = timeLimit;
-  if (balanceGame->levelStartTime > 0) {
-    uint32_t elapsed = millis() - balanceGame->levelStartTime;
-    timeLeft = (elapsed < timeLimit) ? timeLimit - elapsed : 0;
-  }
-  int timerFill = (int)(timeLeft * 200 / timeLimit);
-  gfx->fillRect(20, GAME_Y + GAME_H + 20, 200, 5, COL_DARK);
-  uint16_t tc = (timeLeft > timeLimit / 2) ? COL_GREEN : (timeLeft > timeLimit / 4 ? COL_YELLOW : COL_PINK);
-  if (timerFill > 0) gfx->fillRect(20, GAME_Y + GAME_H + 20, timerFill, 5, tc);
-  gfx->drawRect(20, GAME_Y + GAME_H + 20, 200, 5, COL_DIM);
+  barInvalidate(timerBar);
+  drawTimerBar();
 
   gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
   gfx->setCursor(8, GAME_Y + GAME_H + 34);
@@ -157,30 +247,48 @@ void uiPlayBalanceDraw() {
 // ══════════════════════════════════════════════════════════
 
 void uiPlayBalanceAnimate() {
-  // Erase previous ball position — redraw all cells the circle overlapped
-  if (prevBallX >= 0) {
-    eraseBallAt(prevBallX, prevBallY);
-  }
-
+  // Ball: restore the old 7×7 patch from the maze cache and draw
+  // the new one — a single window when they overlap, nothing at
+  // all when the ball hasn't moved a pixel
   float bx = balanceGameGetBallX();
   float by = balanceGameGetBallY();
-
-  // Draw new ball position
-  drawBallAt(bx, by, COL_BALL_C);
+  int sx, sy;
+  gameToScreen(bx, by, sx, sy);
+#if PLAYFIELD_HALF_RES
+  if (field.ready()) {
+    int hx = field.toX(sx), hy = field.toY(sy);
+    if (prevBallX < 0) {
+      fieldMoveBall(hx, hy, hx, hy);
+    } else {
+      int px, py;
+      gameToScreen(prevBallX, prevBallY, px, py);
+      if (field.toX(px) != hx || field.toY(py) != hy)
+        fieldMoveBall(field.toX(px), field.toY(py), hx, hy);
+    }
+  } else
+#endif
+  if (prevBallX < 0) {
+    composeMaze(sx - 3, sy - 3, sx + 4, sy + 4, sx, sy);
+  } else {
+    int px, py;
+    gameToScreen(prevBallX, prevBallY, px, py);
+    if (px != sx || py != sy) {
+      if (abs(px - sx) < 7 && abs(py - sy) < 7) {
+        composeMaze(min(px, sx) - 3, min(py, sy) - 3,
+                    max(px, sx) + 4, max(py, sy) + 4, sx, sy);
+      } else {
+        composeMaze(px - 3, py - 3, px + 4, py + 4, sx, sy);
+        composeMaze(sx - 3, sy - 3, sx + 4, sy + 4, sx, sy);
+      }
+    }
+  }
   prevBallX = bx;
   prevBallY = by;
 
+  fieldSetInt(scoreField, balanceGameGetScore());
+
   // ─── TIMER BAR UPDATE ─────────────────────────────────
-  uint32_t timeLimit = balanceGame->levelTimeLimit;
-  uint32_t timeLeft = timeLimit;
-  if (balanceGame->levelStartTime > 0) {
-    uint32_t elapsed = millis() - balanceGame->levelStartTime;
-    timeLeft = (elapsed < timeLimit) ? timeLimit - elapsed : 0;
-  }
-  int timerFill = (int)(timeLeft * 200 / timeLimit);
-  gfx->fillRect(20, GAME_Y + GAME_H + 20, 200, 5, COL_DARK);
-  uint16_t tc = (timeLeft > timeLimit / 2) ? COL_GREEN : (timeLeft > timeLimit / 4 ? COL_YELLOW : COL_PINK);
-  if (timerFill > 0) gfx->fillRect(20, GAME_Y + GAME_H + 20, timerFill, 5, tc);
+  drawTimerBar();
 
   // ─── LEVEL COMPLETE OVERLAY ────────────────────────────
   if (balanceGameIsLevelComplete()) {
@@ -207,8 +315,7 @@ void uiPlayBalanceAnimate() {
       completeTime = 0;
       prevBallX = -1;
       if (isLastLevel) {
-        pet.happy  = (uint8_t)min(100, (int)pet.happy  + 20);
-        pet.energy = (uint8_t)max(0,   (int)pet.energy -  5);
+        petAdjust(+20, -5);
         navSwitchView(VIEW_MAIN);
       } else {
         balanceGameCheckWinCondition();
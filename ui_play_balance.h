@@ -7,6 +7,13 @@
 
 #include "types.h"
 
+// On view switch into the game: forget the previous visit's
+// ball position so the first paint (or slide strip) sets it
+void uiPlayBalanceEnter();
+
+// On view switch out of the game: release the maze cache
+void uiPlayBalanceExit();
+
 // Full screen draw (when entering balance game)
 void uiPlayBalanceDraw();
 
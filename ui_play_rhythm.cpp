@@ -7,6 +7,45 @@
 #include "game_rhythm.h"
 #include "nav.h"
 #include "ui_common.h"
+#include "ui_text.h"
+#include "ui_field.h"
+
+// ── Retained score + counter fields ──────────────────────
+static TextField scoreField   = { 100, 125, 2, 6, COL_YELLOW, COL_BG_PLAY };
+static TextField perfectField = { 66,  170, 1, 4, COL_GREEN,  COL_BG_PLAY };
+static TextField goodField    = { 136, 170, 1, 4, COL_YELLOW, COL_BG_PLAY };
+static TextField missField    = { 60,  185, 1, 4, COL_PINK,   COL_BG_PLAY };
+
+// ── Beat meter (delta bar; "TAP!" rides on top of it) ────
+static BarField meterBar = { 12, 56, SCREEN_W - 24, 48, COL_DARK, COL_DIM,
+                             false, "TAP!", 60, 75, 3, COL_WHITE };
+
+static void drawBeatMeter() {
+  if (rhythmGame.roundStartTime == 0) {
+    barSetFraction(meterBar, 0, 1, COL_GREEN);
+    return;
+  }
+  uint32_t interval = rhythmGame.beatInterval;
+  uint32_t phase = (millis() - rhythmGame.roundStartTime) % interval;
+
+  // Color: green -> yellow -> red as beat approaches
+  uint16_t barColor;
+  if (phase * 3 < interval) {
+    barColor = COL_GREEN;
+  } else if (phase * 3 < 2 * interval) {
+    barColor = COL_YELLOW;
+  } else {
+    barColor = COL_PINK;
+  }
+  barSetFraction(meterBar, phase, interval, barColor);
+}
+
+static void updateScoreFields() {
+  fieldSetInt(scoreField,   rhythmGame.totalScore);
+  fieldSetInt(perfectField, rhythmGame.perfectCount);
+  fieldSetInt(goodField,    rhythmGame.goodCount);
+  fieldSetInt(missField,    rhythmGame.missCount);
+}
 
 // ══════════════════════════════════════════════════════════
 //  FULL DRAW (on view entry)
@@ -31,60 +70,42 @@ void uiPlayRhythmDraw() {
                         (rhythmGame.beatInterval == 800) ? "MEDIUM" : "HARD";
   gfx->printf("Speed: %s", diffStr);
 
-  // ─── BEAT METER FILL ──────────────────────────────────
-  if (rhythmGame.roundStartTime > 0) {
-    uint32_t elapsed = millis() - rhythmGame.roundStartTime;
-    int barFill = ((elapsed % rhythmGame.beatInterval) * (SCREEN_W - 20)) / rhythmGame.beatInterval;
-
-    // Color: green -> yellow -> red as beat approaches
-    uint16_t barColor;
-    if (barFill < (SCREEN_W - 20) / 3) {
-      barColor = COL_GREEN;
-    } else if (barFill < 2 * (SCREEN_W - 20) / 3) {
-      barColor = COL_YELLOW;
-    } else {
-      barColor = COL_PINK;
-    }
-
-    gfx->fillRect(12, 56, barFill, 48, barColor);
-  }
-
-  // ─── "TAP NOW!" TEXT OVERLAY ──────────────────────────
-  gfx->setTextColor(COL_WHITE); gfx->setTextSize(3);
-  gfx->setCursor(60, 75);
-  gfx->print("TAP!");
+  // ─── BEAT METER FILL + "TAP NOW!" OVERLAY ─────────────
+  barInvalidate(meterBar);
+  drawBeatMeter();
 
   // ─── SCORE SECTION ────────────────────────────────────
   gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
   gfx->setCursor(12, 130);
   gfx->print("SCORE:");
 
-  gfx->setTextColor(COL_YELLOW); gfx->setTextSize(2);
-  char sbuf[12];
-  sprintf(sbuf, "%d", rhythmGame.totalScore);
-  gfx->setCursor(100, 125);
-  gfx->print(sbuf);
-
   gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
   gfx->setCursor(12, 150);
   gfx->print("BEST:");
   gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
-  sprintf(sbuf, "%d", rhythmGame.bestScore);
+  char sbuf[12];
+  fmtInt(sbuf, rhythmGame.bestScore);
   gfx->setCursor(100, 150);
   gfx->print(sbuf);
 
   // ─── ACCURACY STATS ───────────────────────────────────
   gfx->setTextColor(COL_GREEN); gfx->setTextSize(1);
   gfx->setCursor(12, 170);
-  gfx->printf("Perfect: %d", rhythmGame.perfectCount);
+  gfx->print("Perfect:");
 
   gfx->setTextColor(COL_YELLOW);
   gfx->setCursor(100, 170);
-  gfx->printf("Good: %d", rhythmGame.goodCount);
+  gfx->print("Good:");
 
   gfx->setTextColor(COL_PINK);
   gfx->setCursor(12, 185);
-  gfx->printf("Misses: %d", rhythmGame.missCount);
+  gfx->print("Misses:");
+
+  fieldInvalidate(scoreField);
+  fieldInvalidate(perfectField);
+  fieldInvalidate(goodField);
+  fieldInvalidate(missField);
+  updateScoreFields();
 
   // ─── INSTRUCTIONS ────────────────────────────────────
   gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
@@ -105,45 +126,10 @@ void uiPlayRhythmDraw() {
 
 void uiPlayRhythmAnimate() {
   // ─── BEAT METER UPDATE ────────────────────────────────
-  gfx->fillRect(12, 56, SCREEN_W - 24, 48, COL_DARK);
-
-  if (rhythmGame.roundStartTime > 0) {
-    uint32_t elapsed = millis() - rhythmGame.roundStartTime;
-    int barFill = ((elapsed % rhythmGame.beatInterval) * (SCREEN_W - 20)) / rhythmGame.beatInterval;
-
-    uint16_t barColor;
-    if (barFill < (SCREEN_W - 20) / 3) {
-      barColor = COL_GREEN;
-    } else if (barFill < 2 * (SCREEN_W - 20) / 3) {
-      barColor = COL_YELLOW;
-    } else {
-      barColor = COL_PINK;
-    }
-
-    gfx->fillRect(12, 56, barFill, 48, barColor);
-  }
-
-  gfx->drawRect(8, 50, SCREEN_W - 16, 60, COL_DIM);
-
-  // ─── SCORE UPDATE ────────────────────────────────────
-  gfx->fillRect(100, 120, 80, 20, COL_BG_PLAY);
-  gfx->setTextColor(COL_YELLOW); gfx->setTextSize(2);
-  char sbuf[12];
-  sprintf(sbuf, "%d", rhythmGame.totalScore);
-  gfx->setCursor(100, 132);
-  gfx->print(sbuf);
+  drawBeatMeter();
 
-  // ─── COUNTERS UPDATE ──────────────────────────────────
-  gfx->fillRect(12, 165, SCREEN_W - 24, 20, COL_BG_PLAY);
-  gfx->setTextColor(COL_GREEN); gfx->setTextSize(1);
-  gfx->setCursor(12, 173);
-  gfx->printf("Perfect: %d", rhythmGame.perfectCount);
-  gfx->setTextColor(COL_YELLOW);
-  gfx->setCursor(100, 173);
-  gfx->printf("Good: %d", rhythmGame.goodCount);
-  gfx->setTextColor(COL_PINK);
-  gfx->setCursor(12, 187);
-  gfx->printf("Misses: %d", rhythmGame.missCount);
+  // ─── SCORE + COUNTERS (changed digits only) ───────────
+  updateScoreFields();
 
   // ─── FEEDBACK FLASH ───────────────────────────────────
   if (rhythmGame.feedbackAge > 0) {
@@ -7,20 +7,29 @@
 #include "ui_common.h"
 #include "creature_gen.h"
 #include "nav.h"
+#include "ui_text.h"
+#include "ui_field.h"
+#include "panel_profile.h"
+
+// ── Retained recovery bars + percent labels ───────────────
+static BarField  energyBar = { 30, 212, 180, 8 };
+static BarField  hpBar     = { 30, 240, 180, 8 };
+static TextField energyPct = { 214, 212, 1, 4, COL_CYAN,  COL_BG_SLEEP };
+static TextField hpPct     = { 214, 240, 1, 4, COL_GREEN, COL_BG_SLEEP };
+static TextField lightName = { 147, 262, 1, 8, COL_CYAN,  COL_BG_SLEEP };
+
+static void setPercent(TextField& f, uint8_t val) {
+  char b[6];
+  int n = fmtInt(b, val);
+  b[n] = '%'; b[n + 1] = '\0';
+  fieldSetText(f, b);
+}
 
-// ── Local helper: draw a labelled recovery bar ────────────
-static void drawRecoveryBar(int y, const char* lbl,
-                            uint8_t val, uint16_t col) {
-  gfx->setTextColor(COL_DIM);
-  gfx->setCursor(30, y);
-  gfx->print(lbl);
-
-  drawBarWithBorder(30, y + 12, 180, 8, val, col);
-
-  char b[6]; sprintf(b, "%d%%", val);
-  gfx->setTextColor(col);
-  gfx->setCursor(214, y + 12);
-  gfx->print(b);
+static void updateRecoveryBars() {
+  barSetValue(energyBar, pet.energy, COL_CYAN);
+  setPercent(energyPct, pet.energy);
+  barSetValue(hpBar, pet.hp, COL_GREEN);
+  setPercent(hpPct, pet.hp);
 }
 
 // ══════════════════════════════════════════════════════════
@@ -44,12 +53,22 @@ void uiSleepDraw() {
   gfx->setCursor(170, 62);      gfx->print("z");
 
   // Recovery bars
-  drawRecoveryBar(200, "ENERGY RESTORING:", pet.energy, COL_CYAN);
-  drawRecoveryBar(228, "HP RECOVERING:",    pet.hp,     COL_GREEN);
+  gfx->setTextColor(COL_DIM);
+  gfx->setCursor(30, 200);      gfx->print("ENERGY RESTORING:");
+  gfx->setCursor(30, 228);      gfx->print("HP RECOVERING:");
+  barInvalidate(energyBar);   fieldInvalidate(energyPct);
+  barInvalidate(hpBar);       fieldInvalidate(hpPct);
+  updateRecoveryBars();
+
+  // Hint + panel profile used while asleep
+  gfx->setTextColor(COL_DIM); gfx->setCursor(45, 262);
+  gfx->print("A=WAKE  B=LIGHT:");
+  fieldInvalidate(lightName);
+  uiSleepDrawProfile();
+}
 
-  // Hint
-  gfx->setTextColor(COL_DIM); gfx->setCursor(32, 262);
-  gfx->print("[ A or B ] WAKE UP");
+void uiSleepDrawProfile() {
+  fieldSetText(lightName, profileName(profileSleepChoice()));
 }
 
 // ══════════════════════════════════════════════════════════
@@ -59,8 +78,8 @@ void uiSleepDraw() {
 void uiSleepAnimate() {
   uint16_t bg = COL_BG_SLEEP;
 
-  // Clear pet + zzz area
-  gfx->fillRect(30, 56, 180, 110, bg);
+  // Clear Zzz area only; the pet sprite erases its own old frame
+  gfx->fillRect(150, 60, 26, 34, bg);
 
   int petY = animFrame ? 130 : 126;
   drawPixelPet(120, petY, 's', false);
@@ -71,17 +90,6 @@ void uiSleepAnimate() {
   gfx->setTextSize(1);
   gfx->setCursor(170, animFrame ? 64 : 60); gfx->print("z");
 
-  // Update energy bar
-  gfx->fillRect(30, 212, 186, 8, bg);
-  drawBarWithBorder(30, 212, 180, 8, pet.energy, COL_CYAN);
-  char b[6]; sprintf(b, "%d%%", pet.energy);
-  gfx->fillRect(214, 212, 26, 8, bg);
-  gfx->setTextColor(COL_CYAN); gfx->setCursor(214, 212); gfx->print(b);
-
-  // Update HP bar
-  gfx->fillRect(30, 240, 186, 8, bg);
-  drawBarWithBorder(30, 240, 180, 8, pet.hp, COL_GREEN);
-  sprintf(b, "%d%%", pet.hp);
-  gfx->fillRect(214, 240, 26, 8, bg);
-  gfx->setTextColor(COL_GREEN); gfx->setCursor(214, 240); gfx->print(b);
+  // Recovery bars: only the changed strip / digits are pushed
+  updateRecoveryBars();
 }
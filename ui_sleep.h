@@ -7,3 +7,4 @@
 
 void uiSleepDraw();      // full draw
 void uiSleepAnimate();   // partial: pet bob, Zzz, recovery bars
+void uiSleepDrawProfile();  // partial: night-light profile name
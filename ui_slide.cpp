@@ -0,0 +1,102 @@
+/*
+ * ui_slide.cpp — Hardware-scrolled view transitions
+ * ───────────────────────────────────────────────────
+ * Display line L shows memory row (SSA + L) mod 320; the glass
+ * covers lines 20…299, where view row j normally lives.  After
+ * scrolling up by d rows (SSA = d) the rows hidden off the glass
+ * hold view rows d-40 … d-1: the old rows that just left the
+ * top.  So each step first draws the new-view rows that are
+ * hidden right now, then advances by at most 40 rows — every
+ * row that re-enters at the bottom already holds new content.
+ * Sliding down is the mirror image (SSA = 320 - d).  A full
+ * slide moves 320 rows and lands back on SSA 0.
+ */
+#include "ui_slide.h"
+#include "ui_damage.h"
+#include "fb_indexed.h"
+#include "nav.h"   // navViewBgColor
+
+#define ST_VSCRDEF   0x33
+#define ST_VSCRSADD  0x37
+
+#define SLIDE_ROWS   320                      // ST7789 frame memory
+#define SLIDE_YSTART 20                       // panel row offset
+#define SLIDE_HIDDEN (SLIDE_ROWS - SCREEN_H)  // rows off the glass
+
+static bool     active  = false;
+static SlideDir dir     = SLIDE_UP;
+static uint32_t startMs = 0;
+static int      moved   = 0;   // rows scrolled so far, 0…SLIDE_ROWS
+static int      drawn   = 0;   // new-view rows written, from the leading edge
+
+static void setOffset(int ssa) {
+  bus->beginWrite();
+  bus->writeC8D16(ST_VSCRSADD, ssa % SLIDE_ROWS);
+  bus->endWrite();
+}
+
+// Fill the memory rows outside the view (the band that scrolls
+// between old and new) with the new view's background
+static void fillBand() {
+  Arduino_TFT* panel = static_cast<Arduino_TFT*>(fbPanel());
+  uint16_t bg = navViewBgColor();
+  int half = SLIDE_HIDDEN / 2;
+  panel->startWrite();
+  panel->writeAddrWindow(0, SCREEN_H, SCREEN_W, half);        // rows 300…319
+  panel->writeRepeat(bg, (uint32_t)SCREEN_W * half);
+  panel->writeAddrWindow(0, -SLIDE_YSTART, SCREEN_W, half);   // rows 0…19
+  panel->writeRepeat(bg, (uint32_t)SCREEN_W * half);
+  panel->endWrite();
+}
+
+// New-view rows [a, b) counted from the leading edge
+static void drawStrip(int a, int b) {
+  if (dir == SLIDE_UP) damageRedrawRect(0, a, SCREEN_W, b - a);
+  else                 damageRedrawRect(0, SCREEN_H - b, SCREEN_W, b - a);
+  fbFlush();   // rows must be on the panel before they scroll in
+}
+
+void slideStart(SlideDir d) {
+  bus->beginWrite();
+  bus->writeCommand(ST_VSCRDEF);
+  bus->write16(0);            // TFA
+  bus->write16(SLIDE_ROWS);   // VSA: all of memory
+  bus->write16(0);            // BFA
+  bus->endWrite();
+
+  active  = true;
+  dir     = d;
+  startMs = millis();
+  moved   = 0;
+  drawn   = 0;
+  fillBand();
+}
+
+bool slideActive() {
+  return active;
+}
+
+void slideStep() {
+  if (!active) return;
+
+  int target = (int)((millis() - startMs) * SLIDE_ROWS / SLIDE_MS);
+  target = min(target, min(moved + SLIDE_HIDDEN, SLIDE_ROWS));
+  if (target <= moved) return;
+
+  // Rows that left the glass so far are hidden now: draw them
+  int want = min(moved, (int)SCREEN_H);
+  if (want > drawn) {
+    drawStrip(drawn, want);
+    drawn = want;
+  }
+
+  setOffset(dir == SLIDE_UP ? target : SLIDE_ROWS - target);
+  moved = target;
+  if (moved == SLIDE_ROWS) active = false;
+}
+
+void slideAbort() {
+  if (!active) return;
+  setOffset(0);
+  active = false;
+}
@@ -0,0 +1,34 @@
+/*
+ * ui_slide.h — Hardware-scrolled view transitions
+ * ─────────────────────────────────────────────────
+ * The ST7789 scroll area (VSCRDEF) is set to all 320 rows of
+ * panel memory, a ring the display window is rotated around
+ * with one VSCRSADD; 40 of those rows are always off the glass.
+ * New-view row i always lives at its normal memory row, so each
+ * step draws only the strip of rows that has just scrolled off
+ * screen (clipped, through the damage path) and moves everything
+ * else for free.  Strips are drawn before VSCRSADD advances, so
+ * nothing is ever written into a visible row.
+ *
+ *   SLIDE_UP    new view rises from the bottom
+ *   SLIDE_DOWN  new view drops in from the top (going back)
+ *
+ * The off-glass rows scroll through between the two views as a
+ * 40-row band of the new view's background.
+ *
+ * While a slide runs it owns the panel: the loop skips view
+ * animation and partial redraws until slideActive() is false.
+ */
+#pragma once
+
+#include "types.h"
+
+enum SlideDir : uint8_t { SLIDE_UP, SLIDE_DOWN };
+
+// Begin sliding the (already switched-to) current view in
+void slideStart(SlideDir dir);
+bool slideActive();
+// Advance by elapsed time (called every loop pass while active)
+void slideStep();
+// Snap back to an unscrolled panel (the caller redraws)
+void slideAbort();
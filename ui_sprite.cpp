@@ -0,0 +1,121 @@
+/*
+ * ui_sprite.cpp — Cached pet sprites
+ * ────────────────────────────────────
+ * Small LRU of Arduino_Canvas framebuffers, one per variant.
+ * Falls back to direct primitive drawing if a canvas can't
+ * be allocated, so a low-heap device still shows the pet.
+ */
+#include "ui_sprite.h"
+#include "ui_common.h"    // rasterPixelPet
+#include "creature_gen.h"
+#include "nav.h"          // navViewBgColor
+
+struct PetSprite {
+  Arduino_Canvas* canvas  = nullptr;
+  char            mood    = 0;
+  bool            large   = false;
+  uint16_t        bg      = 0;
+  uint16_t        gen     = 0;
+  int16_t         originX = 0;    // pet centre inside the canvas
+  int16_t         originY = 0;
+  uint32_t        lastUse = 0;
+};
+
+static PetSprite slots[PET_SPRITE_SLOTS];
+static uint32_t  useCounter = 0;
+
+// ══════════════════════════════════════════════════════════
+//  GEOMETRY
+// ══════════════════════════════════════════════════════════
+
+// Conservative pet bounds around (cx, cy) for the current DNA.
+// Covers tail circles, ears/fin above and feet below.
+static void spriteExtents(int s, int& halfW, int& above, int& below) {
+  const CreatureDNA& d = creatureDNA;
+  halfW = (d.bodyWidth  + 4) * s + 2;   // tail tip + radius
+  above = (d.bodyHeight + 5) * s + 2;   // tall ears
+  below = (d.bodyHeight + 2) * s + 2;   // feet
+}
+
+// ══════════════════════════════════════════════════════════
+//  CACHE
+// ══════════════════════════════════════════════════════════
+
+static void releaseSlot(PetSprite& sp) {
+  delete sp.canvas;
+  sp = PetSprite();
+}
+
+static PetSprite* findSlot(char mood, bool large, uint16_t bg) {
+  for (int i = 0; i < PET_SPRITE_SLOTS; i++) {
+    PetSprite& sp = slots[i];
+    if (sp.canvas && sp.mood == mood && sp.large == large && sp.bg == bg)
+      return &sp;
+  }
+  return nullptr;
+}
+
+static PetSprite* victimSlot() {
+  PetSprite* best = &slots[0];
+  for (int i = 0; i < PET_SPRITE_SLOTS; i++) {
+    if (!slots[i].canvas) return &slots[i];
+    if (slots[i].lastUse < best->lastUse) best = &slots[i];
+  }
+  return best;
+}
+
+static bool buildSlot(PetSprite& sp, char mood, bool large, uint16_t bg) {
+  int s = large ? 3 : 2;
+  int halfW, above, below;
+  spriteExtents(s, halfW, above, below);
+  int w = halfW * 2 + 1;
+  int h = above + below + 1 + PET_SPRITE_BOB * 2;
+
+  // Reuse the canvas if the variant has the same footprint
+  if (sp.canvas && (sp.canvas->width() != w || sp.canvas->height() != h))
+    releaseSlot(sp);
+  if (!sp.canvas) {
+    sp.canvas = new Arduino_Canvas(w, h, gfx);
+    if (!sp.canvas->begin(GFX_SKIP_OUTPUT_BEGIN)) {
+      releaseSlot(sp);
+      return false;
+    }
+  }
+
+  sp.originX = halfW;
+  sp.originY = above + PET_SPRITE_BOB;
+  sp.canvas->fillScreen(bg);
+  rasterPixelPet(sp.canvas, sp.originX, sp.originY, mood, large, bg);
+
+  sp.mood  = mood;
+  sp.large = large;
+  sp.bg    = bg;
+  sp.gen   = creatureDNA.visualGen;
+  return true;
+}
+
+// ══════════════════════════════════════════════════════════
+//  PUBLIC
+// ══════════════════════════════════════════════════════════
+
+void petSpriteDraw(int cx, int cy, char mood, bool large) {
+  uint16_t bg = navViewBgColor();
+
+  PetSprite* sp = findSlot(mood, large, bg);
+  if (!sp || sp->gen != creatureDNA.visualGen) {
+    if (!sp) sp = victimSlot();
+    if (!buildSlot(*sp, mood, large, bg)) {
+      rasterPixelPet(gfx, cx, cy, mood, large, bg);
+      return;
+    }
+  }
+  sp->lastUse = ++useCounter;
+
+  gfx->draw16bitRGBBitmap(cx - sp->originX, cy - sp->originY,
+                          sp->canvas->getFramebuffer(),
+                          sp->canvas->width(), sp->canvas->height());
+}
+
+void petSpriteFlush() {
+  for (int i = 0; i < PET_SPRITE_SLOTS; i++) releaseSlot(slots[i]);
+}
@@ -0,0 +1,24 @@
+/*
+ * ui_sprite.h — Cached pet sprites
+ * ──────────────────────────────────
+ * Rasterizes each pet variant (mood × scale × view bg) once
+ * into an off-screen RGB565 canvas and blits it with a single
+ * windowed bitmap push instead of dozens of primitive calls.
+ *
+ * Sprites carry PET_SPRITE_BOB rows of background above and
+ * below the pet, so blitting at the other bob offset also
+ * erases the previous frame — no clear-then-redraw flicker.
+ * Entries rebuild only when creatureDNA.visualGen changes.
+ */
+#pragma once
+
+#include "types.h"
+
+#define PET_SPRITE_BOB    4   // max vertical bob between anim frames (px)
+#define PET_SPRITE_SLOTS  4   // cached variants kept in RAM
+
+// Draw the pet centred at (cx, cy) on the current view background
+void petSpriteDraw(int cx, int cy, char mood, bool large);
+
+// Free every cached canvas (e.g. before a RAM-hungry game view)
+void petSpriteFlush();
@@ -7,23 +7,41 @@
 #include "ui_common.h"
 #include "creature_gen.h"
 #include "pet.h"
+#include "ui_dlist.h"
+#include "frame_gov.h"
 
-void uiStatusDraw() {
+static const char* const keys[] = {"NAME","AGE","WEIGHT","HP",
+                                   "MOOD","SEED","HI-SCORE","UP / ASLEEP"};
+
+// Header, card frames and keys never change — recorded once
+static DisplayList chrome = { "status" };
+
+static void drawChrome() {
   drawViewHeader("STATUS", COL_PURPLE, "A/B = BACK");
+  for (int i = 0; i < 8; i++) {
+    int y = 28 + i * 30;
+    gfx->fillRoundRect(4, y, SCREEN_W - 8, 24, 3, COL_CARD);
+    gfx->drawRoundRect(4, y, SCREEN_W - 8, 24, 3, COL_CARD_B);
+    gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
+    gfx->setCursor(12, y + 8);  gfx->print(keys[i]);
+  }
+}
+
+void uiStatusDraw() {
+  dlistDraw(chrome, drawChrome);
 
-  char ageStr[12], wStr[10], hpStr[10], scoreStr[8], uptimeStr[12];
+  char ageStr[12], wStr[10], hpStr[10], scoreStr[8], uptimeStr[20];
   char seedStr[12];
   uint32_t up = millis() / 1000;
   sprintf(ageStr,    "%d DAYS", pet.age);
   sprintf(wStr,      "%d G",    pet.weight);
   sprintf(hpStr,     "%d/100",  pet.hp);
   sprintf(scoreStr,  "%d",      starGame.bestScore);
-  sprintf(uptimeStr, "%02d:%02d:%02d",
-          (int)(up/3600), (int)((up%3600)/60), (int)(up%60));
+  sprintf(uptimeStr, "%02d:%02d:%02d  %d%%",
+          (int)(up/3600), (int)((up%3600)/60), (int)(up%60),
+          govAsleepPct());
   sprintf(seedStr,   "%08lX", (unsigned long)creatureDNA.seed);
 
-  const char*    keys[] = {"NAME","AGE","WEIGHT","HP",
-                           "MOOD","SEED","HI-SCORE","UPTIME"};
   const char*    vals[] = {creatureDNA.name, ageStr, wStr, hpStr,
                            petGetMoodString(), seedStr,
                            scoreStr, uptimeStr};
@@ -32,11 +50,7 @@ void uiStatusDraw() {
 
   for (int i = 0; i < 8; i++) {
     int y = 28 + i * 30;
-    gfx->fillRoundRect(4, y, SCREEN_W - 8, 24, 3, COL_CARD);
-    gfx->drawRoundRect(4, y, SCREEN_W - 8, 24, 3, COL_CARD_B);
-    gfx->setTextColor(COL_DIM); gfx->setTextSize(1);
-    gfx->setCursor(12, y + 8);  gfx->print(keys[i]);
-    gfx->setTextColor(vc[i]);
+    gfx->setTextColor(vc[i]); gfx->setTextSize(1);
     gfx->setCursor(SCREEN_W - (int)strlen(vals[i]) * 6 - 12, y + 8);
     gfx->print(vals[i]);
   }
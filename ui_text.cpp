@@ -0,0 +1,186 @@
+/*
+ * ui_text.cpp — Glyph atlas & opaque text runs
+ * ──────────────────────────────────────────────
+ */
+#include "ui_text.h"
+
+// ══════════════════════════════════════════════════════════
+//  GLYPH ATLAS  (ASCII 0x20–0x7E, 8 rows × 5 cols, MSB = left)
+// ══════════════════════════════════════════════════════════
+
+#define ATLAS_FIRST  0x20
+#define ATLAS_LAST   0x7E
+
+static const uint8_t atlas[(ATLAS_LAST - ATLAS_FIRST + 1) * 8] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // space
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00,  // !
+  0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,  // "
+  0x50, 0x50, 0xF8, 0x50, 0xF8, 0x50, 0x50, 0x00,  // #
+  0x20, 0x78, 0xA0, 0x70, 0x28, 0xF0, 0x20, 0x00,  // $
+  0xC0, 0xC8, 0x10, 0x20, 0x40, 0x98, 0x18, 0x00,  // %
+  0x40, 0xA0, 0xA0, 0x40, 0xA8, 0x90, 0x68, 0x00,  // &
+  0x30, 0x30, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,  // '
+  0x10, 0x20, 0x40, 0x40, 0x40, 0x20, 0x10, 0x00,  // (
+  0x40, 0x20, 0x10, 0x10, 0x10, 0x20, 0x40, 0x00,  // )
+  0x20, 0xA8, 0x70, 0xF8, 0x70, 0xA8, 0x20, 0x00,  // *
+  0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00, 0x00,  // +
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x20, 0x40,  // ,
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,  // -
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00,  // .
+  0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00,  // /
+  0x70, 0x88, 0x98, 0xA8, 0xC8, 0x88, 0x70, 0x00,  // 0
+  0x20, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,  // 1
+  0x70, 0x88, 0x08, 0x70, 0x80, 0x80, 0xF8, 0x00,  // 2
+  0xF8, 0x08, 0x10, 0x30, 0x08, 0x88, 0x70, 0x00,  // 3
+  0x10, 0x30, 0x50, 0x90, 0xF8, 0x10, 0x10, 0x00,  // 4
+  0xF8, 0x80, 0xF0, 0x08, 0x08, 0x88, 0x70, 0x00,  // 5
+  0x38, 0x40, 0x80, 0xF0, 0x88, 0x88, 0x70, 0x00,  // 6
+  0xF8, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00,  // 7
+  0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x70, 0x00,  // 8
+  0x70, 0x88, 0x88, 0x78, 0x08, 0x10, 0xE0, 0x00,  // 9
+  0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,  // :
+  0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x40, 0x00,  // ;
+  0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x00,  // <
+  0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00,  // =
+  0x40, 0x20, 0x10, 0x08, 0x10, 0x20, 0x40, 0x00,  // >
+  0x70, 0x88, 0x08, 0x30, 0x20, 0x00, 0x20, 0x00,  // ?
+  0x70, 0x88, 0xA8, 0xB8, 0xB0, 0x80, 0x78, 0x00,  // @
+  0x20, 0x50, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x00,  // A
+  0xF0, 0x88, 0x88, 0xF0, 0x88, 0x88, 0xF0, 0x00,  // B
+  0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70, 0x00,  // C
+  0xF0, 0x88, 0x88, 0x88, 0x88, 0x88, 0xF0, 0x00,  // D
+  0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0xF8, 0x00,  // E
+  0xF8, 0x80, 0x80, 0xF0, 0x80, 0x80, 0x80, 0x00,  // F
+  0x78, 0x88, 0x80, 0x80, 0x98, 0x88, 0x78, 0x00,  // G
+  0x88, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x88, 0x00,  // H
+  0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,  // I
+  0x38, 0x10, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00,  // J
+  0x88, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x88, 0x00,  // K
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF8, 0x00,  // L
+  0x88, 0xD8, 0xA8, 0xA8, 0xA8, 0x88, 0x88, 0x00,  // M
+  0x88, 0x88, 0xC8, 0xA8, 0x98, 0x88, 0x88, 0x00,  // N
+  0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00,  // O
+  0xF0, 0x88, 0x88, 0xF0, 0x80, 0x80, 0x80, 0x00,  // P
+  0x70, 0x88, 0x88, 0x88, 0xA8, 0x90, 0x68, 0x00,  // Q
+  0xF0, 0x88, 0x88, 0xF0, 0xA0, 0x90, 0x88, 0x00,  // R
+  0x70, 0x88, 0x80, 0x70, 0x08, 0x88, 0x70, 0x00,  // S
+  0xF8, 0xA8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,  // T
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00,  // U
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00,  // V
+  0x88, 0x88, 0x88, 0xA8, 0xA8, 0xA8, 0x50, 0x00,  // W
+  0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88, 0x00,  // X
+  0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x20, 0x00,  // Y
+  0xF8, 0x08, 0x10, 0x70, 0x40, 0x80, 0xF8, 0x00,  // Z
+  0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x78, 0x00,  // [
+  0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00,  // backslash
+  0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x00,  // ]
+  0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,  // ^
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,  // _
+  0x60, 0x60, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00,  // `
+  0x00, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,  // a
+  0x80, 0x80, 0xB0, 0xC8, 0x88, 0xC8, 0xB0, 0x00,  // b
+  0x00, 0x00, 0x70, 0x88, 0x80, 0x88, 0x70, 0x00,  // c
+  0x08, 0x08, 0x68, 0x98, 0x88, 0x98, 0x68, 0x00,  // d
+  0x00, 0x00, 0x70, 0x88, 0xF8, 0x80, 0x70, 0x00,  // e
+  0x10, 0x28, 0x20, 0x70, 0x20, 0x20, 0x20, 0x00,  // f
+  0x00, 0x00, 0x70, 0x98, 0x98, 0x68, 0x08, 0x70,  // g
+  0x80, 0x80, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x00,  // h
+  0x20, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00,  // i
+  0x10, 0x00, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00,  // j
+  0x80, 0x80, 0x90, 0xA0, 0xC0, 0xA0, 0x90, 0x00,  // k
+  0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,  // l
+  0x00, 0x00, 0xD0, 0xA8, 0xA8, 0xA8, 0xA8, 0x00,  // m
+  0x00, 0x00, 0xB0, 0xC8, 0x88, 0x88, 0x88, 0x00,  // n
+  0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00,  // o
+  0x00, 0x00, 0xB0, 0xC8, 0xC8, 0xB0, 0x80, 0x80,  // p
+  0x00, 0x00, 0x68, 0x98, 0x98, 0x68, 0x08, 0x08,  // q
+  0x00, 0x00, 0xB0, 0xC8, 0x80, 0x80, 0x80, 0x00,  // r
+  0x00, 0x00, 0x78, 0x80, 0x70, 0x08, 0xF0, 0x00,  // s
+  0x20, 0x20, 0xF8, 0x20, 0x20, 0x28, 0x10, 0x00,  // t
+  0x00, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00,  // u
+  0x00, 0x00, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00,  // v
+  0x00, 0x00, 0x88, 0x88, 0xA8, 0xA8, 0x50, 0x00,  // w
+  0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x00,  // x
+  0x00, 0x00, 0x88, 0x88, 0x78, 0x08, 0x88, 0x70,  // y
+  0x00, 0x00, 0xF8, 0x10, 0x20, 0x40, 0xF8, 0x00,  // z
+  0x10, 0x20, 0x20, 0x40, 0x20, 0x20, 0x10, 0x00,  // {
+  0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00,  // |
+  0x40, 0x20, 0x20, 0x10, 0x20, 0x20, 0x40, 0x00,  // }
+  0x40, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,  // ~
+};
+
+// ══════════════════════════════════════════════════════════
+//  RUN BUFFER
+// ══════════════════════════════════════════════════════════
+
+// One full-width size-1 text line.  Larger runs are pushed in
+// bands of as many whole rows as fit.
+#define RUN_BUF_PX  (SCREEN_W * TEXT_CHAR_H)
+static uint16_t runBuf[RUN_BUF_PX];
+
+static inline uint8_t glyphRow(char c, int row) {
+  uint8_t ch = (uint8_t)c;
+  if (ch < ATLAS_FIRST || ch > ATLAS_LAST) ch = '?';
+  return pgm_read_byte(&atlas[(ch - ATLAS_FIRST) * 8 + row]);
+}
+
+// Render output rows [y0, y1) of the run into runBuf
+static void buildRows(const char* str, int len, uint8_t size,
+                      uint16_t fg, uint16_t bg, int w, int y0, int y1) {
+  uint16_t* p = runBuf;
+  for (int y = y0; y < y1; y++) {
+    int row = y / size;
+    int x = 0;
+    for (int i = 0; i < len; i++) {
+      uint8_t bits = glyphRow(str[i], row);
+      for (int col = 0; col < TEXT_CHAR_W; col++) {
+        uint16_t c = (bits & (0x80 >> col)) ? fg : bg;  // col 5 = spacing
+        for (int k = 0; k < size; k++) p[x++] = c;
+      }
+    }
+    while (x < w) p[x++] = bg;
+    p += w;
+  }
+}
+
+// ══════════════════════════════════════════════════════════
+//  PUBLIC
+// ══════════════════════════════════════════════════════════
+
+int textRun(int x, int y, const char* str, uint8_t size,
+            uint16_t fg, uint16_t bg, int padW) {
+  size = constrain(size, (uint8_t)1, (uint8_t)3);
+  int len = strlen(str);
+  int w   = max(len * TEXT_CHAR_W * size, padW);
+  w   = min(w, SCREEN_W - x);
+  len = min(len, w / (TEXT_CHAR_W * size));
+  int h = TEXT_CHAR_H * size;
+  if (w <= 0) return 0;
+
+  int bandRows = min(h, RUN_BUF_PX / w);
+  for (int y0 = 0; y0 < h; y0 += bandRows) {
+    int y1 = min(h, y0 + bandRows);
+    buildRows(str, len, size, fg, bg, w, y0, y1);
+    gfx->draw16bitRGBBitmap(x, y + y0, runBuf, w, y1 - y0);
+  }
+  return w;
+}
+
+uint8_t textGlyphRow(char c, int row) {
+  return glyphRow(c, row);
+}
+
+int fmtInt(char* buf, int32_t v, uint8_t width, char pad) {
+  char tmp[12];
+  int  n = 0;
+  bool neg = v < 0;
+  uint32_t u = neg ? (uint32_t)(-(int64_t)v) : (uint32_t)v;
+  do { tmp[n++] = '0' + (u % 10); u /= 10; } while (u);
+  if (neg) tmp[n++] = '-';
+
+  int len = 0;
+  while (len + n < width) buf[len++] = pad;
+  while (n) buf[len++] = tmp[--n];
+  buf[len] = '\0';
+  return len;
+}
@@ -0,0 +1,32 @@
+/*
+ * ui_text.h — Glyph atlas & opaque text runs
+ * ────────────────────────────────────────────
+ * Classic 5×7 font (same glyphs as the GFX built-in font)
+ * stored row-major in flash.  textRun() builds a whole string,
+ * background included, into a line buffer and pushes it with
+ * one window write — no pre-clear fillRect, no per-pixel SPI.
+ *
+ * Sizes 1–3 are expanded from the same atlas while the run is
+ * built.  fmtInt() is an allocation-free sprintf("%d")
+ * replacement for the hot paths.
+ */
+#pragma once
+
+#include "types.h"
+
+#define TEXT_CHAR_W   6    // glyph cell at size 1 (5 px + 1 spacing)
+#define TEXT_CHAR_H   8
+
+// Draw str at (x, y) opaque on bg.  The run is padded with bg
+// out to padW pixels so shorter text erases longer old text.
+// Returns the pixel width covered.
+int textRun(int x, int y, const char* str, uint8_t size,
+            uint16_t fg, uint16_t bg, int padW = 0);
+
+// Row bits of a glyph (MSB = left column) for compositors that
+// rasterise text themselves.  Unknown chars map to '?'.
+uint8_t textGlyphRow(char c, int row);
+
+// Write v in decimal into buf (NUL-terminated), right-aligned
+// to width with pad.  Returns the number of chars written.
+int fmtInt(char* buf, int32_t v, uint8_t width = 0, char pad = ' ');